@@ -0,0 +1,22 @@
+#version 430 core
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 uv;
+
+// Current Segment of Mirage::Bridge, Bound with Bridge::bind()
+layout (std430, binding = 1) readonly buffer Models { mat4 models[]; };
+
+// Instances of One Mesh Use Consecutive Slots Starting Here
+uniform uint slot;
+uniform mat4 view_projection;
+
+out vec3 vertex_normal;
+out vec2 vertex_uv;
+
+void main()
+{
+    mat4 model = models[slot + gl_InstanceID];
+    gl_Position = view_projection * model * vec4(position, 1.0);
+    vertex_normal = mat3(model) * normal;
+    vertex_uv = uv;
+}
@@ -0,0 +1,47 @@
+#version 330 core
+in vec3 view_position;
+in vec3 view_normal;
+in vec2 vertex_uv;
+
+// Set by Mirage::Clusters::bind(); Lights Take Three Texels Each:
+// Position and Radius, Color and Inner Cone, Direction and Outer Cone
+uniform samplerBuffer  lights;
+uniform usamplerBuffer clusters;
+uniform usamplerBuffer indices;
+uniform uvec3 cluster_grid;
+uniform vec2  tile_size;
+uniform vec2  slice_scale_bias;
+
+out vec4 color;
+
+void main()
+{
+    // Find this Fragment's Cluster from its Tile and Exponential Depth Slice
+    uvec2 tile = min(uvec2(gl_FragCoord.xy / tile_size), cluster_grid.xy - 1u);
+    float depth = log(max(-view_position.z, 1e-4)) * slice_scale_bias.x + slice_scale_bias.y;
+    uint slice = min(uint(max(depth, 0.0)), cluster_grid.z - 1u);
+    uint cluster = (slice * cluster_grid.y + tile.y) * cluster_grid.x + tile.x;
+    uvec2 range = texelFetch(clusters, int(cluster)).xy;
+
+    vec3 normal = normalize(view_normal);
+    vec3 eye = normalize(-view_position);
+    vec3 result = vec3(0.05);
+    for (uint i = 0u; i < range.y; i++)
+    {
+        int light = int(texelFetch(indices, int(range.x + i)).x) * 3;
+        vec4 position_radius = texelFetch(lights, light);
+        vec4 color_inner = texelFetch(lights, light + 1);
+        vec4 direction_outer = texelFetch(lights, light + 2);
+
+        vec3 incident = position_radius.xyz - view_position;
+        float distance = length(incident);
+        incident /= distance;
+        float falloff = clamp(1.0 - distance / position_radius.w, 0.0, 1.0);
+        float cone = smoothstep(direction_outer.w, color_inner.w, dot(-incident, direction_outer.xyz));
+        float diffuse = max(dot(normal, incident), 0.0);
+        float specular = pow(max(dot(normal, normalize(incident + eye)), 0.0), 32.0);
+        result += color_inner.rgb * (diffuse + specular) * falloff * falloff * cone;
+    }
+
+    color = vec4(result, 1.0);
+}
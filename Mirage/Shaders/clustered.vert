@@ -0,0 +1,22 @@
+#version 330 core
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 uv;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+// Lights are Shaded in View Space
+out vec3 view_position;
+out vec3 view_normal;
+out vec2 vertex_uv;
+
+void main()
+{
+    vec4 position_view = view * model * vec4(position, 1.0);
+    gl_Position = projection * position_view;
+    view_position = position_view.xyz;
+    view_normal = mat3(view * model) * normal;
+    vertex_uv = uv;
+}
@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec4 color;
+
+uniform mat4 view_projection;
+
+out vec4 vertex_color;
+
+void main()
+{
+    gl_Position = view_projection * vec4(position, 1.0);
+    vertex_color = color;
+}
@@ -0,0 +1,11 @@
+#version 430 core
+in vec3 vertex_normal;
+in vec2 vertex_uv;
+
+out vec4 color;
+
+void main()
+{
+    float light = max(dot(normalize(vertex_normal), normalize(vec3(0.3, 1.0, 0.5))), 0.0);
+    color = vec4(vec3(0.2 + 0.8 * light), 1.0);
+}
@@ -0,0 +1,28 @@
+#version 430 core
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 uv;
+layout (location = 3) in uint object;
+
+// Must Match Mirage::Indirect::Object
+struct Object {
+    mat4 model;
+    uint geometry;
+    uint level;
+    uint padding[2];
+};
+
+layout (std430, binding = 0) readonly buffer Objects { Object objects[]; };
+
+uniform mat4 view_projection;
+
+out vec3 vertex_normal;
+out vec2 vertex_uv;
+
+void main()
+{
+    mat4 model = objects[object].model;
+    gl_Position = view_projection * model * vec4(position, 1.0);
+    vertex_normal = mat3(model) * normal;
+    vertex_uv = uv;
+}
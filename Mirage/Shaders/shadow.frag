@@ -0,0 +1,6 @@
+#version 330 core
+
+// Depth Only; the Rasterizer Writes gl_FragCoord.z
+void main()
+{
+}
@@ -0,0 +1,10 @@
+#version 330 core
+layout (location = 0) in vec3 position;
+
+// Light View Projection Times Model, Set by Mesh::depth()
+uniform mat4 transform;
+
+void main()
+{
+    gl_Position = transform * vec4(position, 1.0);
+}
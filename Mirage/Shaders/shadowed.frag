@@ -0,0 +1,34 @@
+#version 330 core
+in vec3 view_position;
+in vec3 view_normal;
+in vec2 vertex_uv;
+
+// Set by Mirage::Shadows::bind(); Matrices Take View Space to Map Coordinates
+uniform sampler2DArrayShadow shadow_map;
+uniform mat4 cascade_matrices[4];
+uniform vec4 cascade_splits;
+
+// Direction the Light Travels, in View Space
+uniform vec3 light_direction;
+uniform vec3 light_color;
+
+out vec4 color;
+
+float shadow()
+{
+    // Nearest Cascade Whose Slice Reaches this Depth
+    float depth = -view_position.z;
+    int cascade = 3;
+    for (int i = 2; i >= 0; i--) if (depth < cascade_splits[i]) cascade = i;
+
+    // Linear Filtering of a Comparison Sampler Averages Four Depth Tests
+    vec4 coord = cascade_matrices[cascade] * vec4(view_position, 1.0);
+    return texture(shadow_map, vec4(coord.xy, float(cascade), coord.z));
+}
+
+void main()
+{
+    vec3 normal = normalize(view_normal);
+    float diffuse = max(dot(normal, -light_direction), 0.0);
+    color = vec4(vec3(0.05) + light_color * diffuse * shadow(), 1.0);
+}
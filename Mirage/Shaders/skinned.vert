@@ -0,0 +1,33 @@
+#version 330 core
+layout (location = 0) in vec3  position;
+layout (location = 1) in vec3  normal;
+layout (location = 2) in vec2  uv;
+layout (location = 3) in uvec4 bones;
+layout (location = 4) in vec4  weights;
+
+// Three Texels per Bone Holding the Rows of an Affine Matrix; See Mirage::Animator
+uniform samplerBuffer bones_palette;
+uniform int bone_offset;
+uniform mat4 transform;
+uniform mat4 model;
+
+out vec3 vertex_normal;
+out vec2 vertex_uv;
+
+mat4 bone(uint index)
+{
+    int texel = (bone_offset + int(index)) * 3;
+    return transpose(mat4(texelFetch(bones_palette, texel),
+                          texelFetch(bones_palette, texel + 1),
+                          texelFetch(bones_palette, texel + 2),
+                          vec4(0.0, 0.0, 0.0, 1.0)));
+}
+
+void main()
+{
+    mat4 skin = bone(bones.x) * weights.x + bone(bones.y) * weights.y
+              + bone(bones.z) * weights.z + bone(bones.w) * weights.w;
+    gl_Position = transform * skin * vec4(position, 1.0);
+    vertex_normal = mat3(model) * mat3(skin) * normal;
+    vertex_uv = uv;
+}
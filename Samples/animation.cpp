@@ -0,0 +1,311 @@
+// Local Headers
+#include "animation.hpp"
+#include "transform.hpp"
+
+// System Headers
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
+// Standard Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+
+// Define Namespace
+namespace Mirage
+{
+    // Ten Pose Components, Laid Out as in Clip: Translation, Rotation xyzw, Scale
+    static void decompose(glm::mat4 const & m, float * trs)
+    {
+        glm::vec3 translation, scale; glm::vec4 rotation;
+        Transforms::decompose(m, translation, rotation, scale);
+        for (int i = 0; i < 3; i++) trs[i] = translation[i], trs[7 + i] = scale[i];
+        for (int i = 0; i < 4; i++) trs[3 + i] = rotation[i];
+    }
+
+    // Build a Local Matrix from Blended Components; Blending Denormalizes Rotations
+    static glm::mat4 compose(float const * pose, std::size_t stride, std::size_t node)
+    {
+        float c[Clip::kComponents];
+        for (unsigned int i = 0; i < Clip::kComponents; i++) c[i] = pose[i * stride + node];
+        return Transforms::compose(glm::vec3(c[0], c[1], c[2]), glm::vec4(c[3], c[4], c[5], c[6]),
+                                   glm::vec3(c[7], c[8], c[9]));
+    }
+
+    // Index of the Last Key at or Before the Given Time
+    template<typename T> static unsigned int search(T const * keys, unsigned int count, double time)
+    {
+        unsigned int lower = 0, upper = count;
+        while (upper - lower > 1)
+        {
+            unsigned int middle = (lower + upper) / 2;
+            if (keys[middle].mTime <= time) lower = middle; else upper = middle;
+        }   return lower;
+    }
+
+    Skeleton::Skeleton(aiNode const * root) : mInverse(glm::inverse(convert(root->mTransformation)))
+    {
+        // Breadth-First, so Every Parent is Stored Before its Children
+        std::deque<std::pair<aiNode const *, int>> queue { std::make_pair(root, -1) };
+        while (queue.empty() == false)
+        {
+            auto node = queue.front(); queue.pop_front();
+            int index = int(mNames.size());
+            mNames.push_back(node.first->mName.C_Str());
+            mParents.push_back(node.second);
+            mLocals.push_back(convert(node.first->mTransformation));
+            for (unsigned int i = 0; i < node.first->mNumChildren; i++)
+                queue.push_back(std::make_pair(node.first->mChildren[i], index));
+        }
+    }
+
+    GLubyte Skeleton::bone(aiBone const * bone)
+    {
+        // Submeshes Often Share Bones; Register Each Name Once
+        std::string name = bone->mName.C_Str();
+        auto found = mIndices.find(name);
+        if (found != mIndices.end()) return found->second;
+        if (mBones.size() > 255) { fprintf(stderr, "Too Many Bones: %s\n", name.c_str()); return 0; }
+
+        int node = find(name);
+        if (node == -1) fprintf(stderr, "Missing Bone Node: %s\n", name.c_str());
+        GLubyte index = GLubyte(mBones.size());
+        mBones.push_back(node == -1 ? 0 : node);
+        mOffsets.push_back(convert(bone->mOffsetMatrix));
+        mIndices.insert(std::make_pair(name, index));
+        return index;
+    }
+
+    GLubyte Skeleton::rigid(std::string const & name, glm::mat4 & bind)
+    {
+        // Bind Placement of the Node Relative to the Root, as Palettes Are
+        int node = find(name);
+        if (node == -1) { fprintf(stderr, "Missing Rigid Node: %s\n", name.c_str()); node = 0; }
+        bind = glm::mat4(1.0f);
+        for (int i = node; i != -1; i = mParents[i]) bind = mLocals[i] * bind;
+        bind = mInverse * bind;
+
+        // Offset by the Inverse so the Baked Vertices Stay Put in the Bind Pose
+        auto found = mRigid.find(node);
+        if (found != mRigid.end()) return found->second;
+        if (mBones.size() > 255) { fprintf(stderr, "Too Many Bones: %s\n", name.c_str()); return 0; }
+        GLubyte index = GLubyte(mBones.size());
+        mBones.push_back(node);
+        mOffsets.push_back(glm::inverse(bind));
+        mRigid.insert(std::make_pair(node, index));
+        return index;
+    }
+
+    int Skeleton::find(std::string const & name) const
+    {
+        auto found = std::find(mNames.begin(), mNames.end(), name);
+        return found == mNames.end() ? -1 : int(found - mNames.begin());
+    }
+
+    void Skeleton::palette(glm::mat4 const * locals, glm::mat4 * worlds, glm::vec4 * palette) const
+    {
+        for (std::size_t i = 0; i < mNames.size(); i++)
+            worlds[i] = mParents[i] < 0 ? locals[i] : worlds[mParents[i]] * locals[i];
+
+        // Store the Top Three Rows; the Last is Always (0, 0, 0, 1)
+        for (std::size_t i = 0; i < mBones.size(); i++)
+        {
+            glm::mat4 m = mInverse * worlds[mBones[i]] * mOffsets[i];
+            for (int row = 0; row < 3; row++)
+                palette[i * 3 + row] = glm::vec4(m[0][row], m[1][row], m[2][row], m[3][row]);
+        }
+    }
+
+    Clip::Clip(aiAnimation const * animation, Skeleton const & skeleton, float rate)
+        : mName(animation->mName.C_Str())
+        , mStride((skeleton.nodes() + 3) & ~std::size_t(3))
+        , mRate(rate)
+    {
+        double ticks = animation->mTicksPerSecond > 0.0 ? animation->mTicksPerSecond : 25.0;
+        mDuration = float(animation->mDuration / ticks);
+        mFrames = std::max<std::size_t>(2, std::size_t(std::ceil(mDuration * rate)) + 1);
+        mKeys.assign(mFrames * kComponents * mStride, 0.0f);
+
+        std::vector<aiNodeAnim const *> channels(skeleton.nodes(), nullptr);
+        for (unsigned int i = 0; i < animation->mNumChannels; i++)
+        {
+            int node = skeleton.find(animation->mChannels[i]->mNodeName.C_Str());
+            if (node != -1) channels[node] = animation->mChannels[i];
+        }
+
+        for (std::size_t node = 0; node < mStride; node++)
+        for (std::size_t frame = 0; frame < mFrames; frame++)
+        {
+            // Nodes Without a Channel (and Padding) Hold their Bind Pose
+            float trs[kComponents] = { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1 };
+            if (node < skeleton.nodes()) decompose(skeleton.local(node), trs);
+            auto channel = node < channels.size() ? channels[node] : nullptr;
+            double time = std::min(double(frame) / rate, double(mDuration)) * ticks;
+            if (channel && channel->mNumPositionKeys)
+            {
+                auto const * keys = channel->mPositionKeys;
+                unsigned int i = search(keys, channel->mNumPositionKeys, time), j = std::min(i + 1, channel->mNumPositionKeys - 1);
+                float t = keys[j].mTime > keys[i].mTime ? float((time - keys[i].mTime) / (keys[j].mTime - keys[i].mTime)) : 0.0f;
+                t = std::min(std::max(t, 0.0f), 1.0f);
+                trs[0] = keys[i].mValue.x + (keys[j].mValue.x - keys[i].mValue.x) * t;
+                trs[1] = keys[i].mValue.y + (keys[j].mValue.y - keys[i].mValue.y) * t;
+                trs[2] = keys[i].mValue.z + (keys[j].mValue.z - keys[i].mValue.z) * t;
+            }
+            if (channel && channel->mNumRotationKeys)
+            {
+                auto const * keys = channel->mRotationKeys;
+                unsigned int i = search(keys, channel->mNumRotationKeys, time), j = std::min(i + 1, channel->mNumRotationKeys - 1);
+                float t = keys[j].mTime > keys[i].mTime ? float((time - keys[i].mTime) / (keys[j].mTime - keys[i].mTime)) : 0.0f;
+                t = std::min(std::max(t, 0.0f), 1.0f);
+                auto a = keys[i].mValue, b = keys[j].mValue;
+                float sign = (a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w) < 0.0f ? -1.0f : 1.0f;
+                trs[3] = a.x + (b.x * sign - a.x) * t;
+                trs[4] = a.y + (b.y * sign - a.y) * t;
+                trs[5] = a.z + (b.z * sign - a.z) * t;
+                trs[6] = a.w + (b.w * sign - a.w) * t;
+            }
+            if (channel && channel->mNumScalingKeys)
+            {
+                auto const * keys = channel->mScalingKeys;
+                unsigned int i = search(keys, channel->mNumScalingKeys, time), j = std::min(i + 1, channel->mNumScalingKeys - 1);
+                float t = keys[j].mTime > keys[i].mTime ? float((time - keys[i].mTime) / (keys[j].mTime - keys[i].mTime)) : 0.0f;
+                t = std::min(std::max(t, 0.0f), 1.0f);
+                trs[7] = keys[i].mValue.x + (keys[j].mValue.x - keys[i].mValue.x) * t;
+                trs[8] = keys[i].mValue.y + (keys[j].mValue.y - keys[i].mValue.y) * t;
+                trs[9] = keys[i].mValue.z + (keys[j].mValue.z - keys[i].mValue.z) * t;
+            }
+
+            // Flip Rotations into the Previous Frame's Hemisphere so Lerps Take the Short Way
+            float * keys = & mKeys[frame * kComponents * mStride + node];
+            if (frame > 0)
+            {
+                float const * last = keys - kComponents * mStride;
+                float dot = 0.0f;
+                for (int i = 3; i < 7; i++) dot += trs[i] * last[i * mStride];
+                if (dot < 0.0f) for (int i = 3; i < 7; i++) trs[i] = -trs[i];
+            }
+            for (unsigned int i = 0; i < kComponents; i++) keys[i * mStride] = trs[i];
+        }
+    }
+
+    void Clip::sample(float time, float weight, float * pose) const
+    {
+        float position = std::min(std::max(time * mRate, 0.0f), float(mFrames - 1));
+        std::size_t frame = std::min(std::size_t(position), mFrames - 2);
+        float t = position - frame;
+        float const * a = & mKeys[frame * kComponents * mStride];
+        float const * b = a + kComponents * mStride;
+
+        // Interpolate Between Frames, then Accumulate Weighted into the Pose
+        for (std::size_t n = 0; n < mStride; n += 4)
+        {
+#if defined(__SSE2__) || defined(_M_X64)
+            __m128 v[kComponents], factor = _mm_set1_ps(t), scale = _mm_set1_ps(weight);
+            for (unsigned int c = 0; c < kComponents; c++)
+            {
+                __m128 from = _mm_loadu_ps(a + c * mStride + n), to = _mm_loadu_ps(b + c * mStride + n);
+                v[c] = _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), factor));
+            }
+
+            // Negate Rotations Facing Away from What's Already Accumulated
+            __m128 dot = _mm_setzero_ps();
+            for (unsigned int c = 3; c < 7; c++) dot = _mm_add_ps(dot, _mm_mul_ps(v[c], _mm_loadu_ps(pose + c * mStride + n)));
+            __m128 flip = _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+            for (unsigned int c = 3; c < 7; c++) v[c] = _mm_xor_ps(v[c], flip);
+
+            for (unsigned int c = 0; c < kComponents; c++)
+            {
+                float * out = pose + c * mStride + n;
+                _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(v[c], scale)));
+            }
+#else
+            for (std::size_t k = n; k < n + 4; k++)
+            {
+                float v[kComponents], dot = 0.0f;
+                for (unsigned int c = 0; c < kComponents; c++)
+                    v[c] = a[c * mStride + k] + (b[c * mStride + k] - a[c * mStride + k]) * t;
+                for (unsigned int c = 3; c < 7; c++) dot += v[c] * pose[c * mStride + k];
+                if (dot < 0.0f) for (unsigned int c = 3; c < 7; c++) v[c] = -v[c];
+                for (unsigned int c = 0; c < kComponents; c++) pose[c * mStride + k] += v[c] * weight;
+            }
+#endif
+        }
+    }
+
+    Animator::Animator(Scheduler & scheduler, Skeleton const & skeleton, std::vector<Clip> const & clips)
+        : mScheduler(scheduler), mSkeleton(skeleton), mClips(clips)
+    {
+        glGenBuffers(1, & mBuffer);
+        glGenTextures(1, & mTexture);
+        glBindBuffer(GL_TEXTURE_BUFFER, mBuffer);
+        glBufferData(GL_TEXTURE_BUFFER, sizeof(glm::vec4), nullptr, GL_STREAM_DRAW);
+        glBindTexture(GL_TEXTURE_BUFFER, mTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, mBuffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    Animator::~Animator()
+    {
+        glDeleteTextures(1, & mTexture);
+        glDeleteBuffers(1, & mBuffer);
+    }
+
+    unsigned int Animator::add(unsigned int clip)
+    {
+        mCharacters.push_back(Character { { clip, clip }, { 0.0f, 0.0f }, 0.0f, 1.0f });
+        return unsigned(mCharacters.size() - 1);
+    }
+
+    void Animator::update(float dt)
+    {
+        std::size_t rows = mSkeleton.bones() * 3;
+        mPalettes.resize(mCharacters.size() * rows);
+        if (mClips.empty()) return;
+
+        mScheduler.parallel_for(mCharacters.size(), 16, [this, dt, rows](std::size_t begin, std::size_t end) {
+            // Scratch Reused by Each Thread Across Frames
+            static thread_local std::vector<float> pose;
+            static thread_local std::vector<glm::mat4> locals, worlds;
+            std::size_t stride = mClips.front().stride(), nodes = mSkeleton.nodes();
+            locals.resize(nodes); worlds.resize(nodes);
+
+            for (std::size_t i = begin; i < end; i++)
+            {
+                auto & character = mCharacters[i];
+                pose.assign(stride * Clip::kComponents, 0.0f);
+                for (int j = 0; j < 2; j++)
+                {
+                    auto const & clip = mClips[character.clips[j]];
+                    float weight = j ? character.blend : 1.0f - character.blend;
+                    float length = clip.duration() > 0.0f ? clip.duration() : 1.0f;
+                    character.times[j] = std::fmod(character.times[j] + dt * character.speed, length);
+                    if (character.times[j] < 0.0f) character.times[j] += length;
+                    if (weight > 0.0f) clip.sample(character.times[j], weight, pose.data());
+                }
+
+                for (std::size_t n = 0; n < nodes; n++) locals[n] = compose(pose.data(), stride, n);
+                mSkeleton.palette(locals.data(), worlds.data(), & mPalettes[i * rows]);
+            }
+        });
+    }
+
+    void Animator::upload()
+    {
+        // Respecifying the Store Orphans Last Frame's Palettes Instead of Stalling
+        if (mPalettes.empty()) return;
+        glBindBuffer(GL_TEXTURE_BUFFER, mBuffer);
+        glBufferData(GL_TEXTURE_BUFFER, mPalettes.size() * sizeof(glm::vec4), & mPalettes.front(), GL_STREAM_DRAW);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    void Animator::bind(GLuint shader, unsigned int character, GLuint unit) const
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_BUFFER, mTexture);
+        glUniform1i(glGetUniformLocation(shader, "bones_palette"), GLint(unit));
+        glUniform1i(glGetUniformLocation(shader, "bone_offset"), GLint(character * mSkeleton.bones()));
+    }
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+// Local Headers
+#include "jobs.hpp"
+
+// System Headers
+#include <assimp/scene.h>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <map>
+#include <string>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Assimp Matrices are Row-Major
+    inline glm::mat4 convert(aiMatrix4x4 const & m)
+    {
+        return glm::mat4(glm::vec4(m.a1, m.b1, m.c1, m.d1), glm::vec4(m.a2, m.b2, m.c2, m.d2),
+                         glm::vec4(m.a3, m.b3, m.c3, m.d3), glm::vec4(m.a4, m.b4, m.c4, m.d4));
+    }
+
+    // Node Hierarchy of a Model Sorted so Parents Precede Children, Plus the
+    // Bones that Skinned Vertices Refer To by Index. Rigid Submeshes Register
+    // their Node as a Bone Too, and Bake their Vertices by the Returned Bind
+    // Placement so they Share the Bind Pose with Skinned Ones
+    class Skeleton
+    {
+    public:
+
+        // Implement Custom Constructor
+        explicit Skeleton(aiNode const * root);
+
+        // Public Member Functions
+        GLubyte bone(aiBone const * bone);
+        GLubyte rigid(std::string const & name, glm::mat4 & bind);
+        int     find(std::string const & name) const;
+        void    palette(glm::mat4 const * locals, glm::mat4 * worlds, glm::vec4 * palette) const;
+        std::size_t nodes() const { return mNames.size(); }
+        std::size_t bones() const { return mBones.size(); }
+        glm::mat4 const & local(std::size_t node) const { return mLocals[node]; }
+
+    private:
+
+        // Private Member Containers
+        std::vector<std::string> mNames;
+        std::vector<int>         mParents;
+        std::vector<glm::mat4>   mLocals;
+        std::vector<int>         mBones;
+        std::vector<glm::mat4>   mOffsets;
+        std::map<std::string, GLubyte> mIndices;
+        std::map<int, GLubyte>         mRigid;
+
+        // Private Member Variables
+        glm::mat4 mInverse;
+
+    };
+
+    // Animation Resampled at a Fixed Rate so Sampling Never Searches for Keys.
+    // Keys are Stored SoA, [Frame][Component][Node], with Translation, Rotation
+    // (xyzw) and Scale as Ten Components and Nodes Padded to a Multiple of Four,
+    // so Sampling Interpolates and Blends Four Nodes at a Time.
+    class Clip
+    {
+    public:
+
+        static const unsigned int kComponents = 10;
+
+        // Implement Custom Constructor
+        Clip(aiAnimation const * animation, Skeleton const & skeleton, float rate = 30.0f);
+
+        // Public Member Functions
+        void  sample(float time, float weight, float * pose) const;
+        float duration() const { return mDuration; }
+        std::size_t stride() const { return mStride; }
+        std::string const & name() const { return mName; }
+
+    private:
+
+        // Private Member Containers
+        std::vector<float> mKeys;
+
+        // Private Member Variables
+        std::string mName;
+        std::size_t mStride;
+        std::size_t mFrames;
+        float       mDuration;
+        float       mRate;
+
+    };
+
+    // Playback State of One Animated Instance; blend is the Second Clip's Weight
+    struct Character {
+        unsigned int clips[2];
+        float times[2];
+        float blend;
+        float speed;
+    };
+
+    // Animates Many Instances of a Skeleton. update() Samples, Blends and
+    // Builds Bone Palettes for Every Character in Parallel; upload() Streams
+    // All Palettes into One Texture Buffer (Three RGBA32F Texels per Bone,
+    // the Rows of an Affine Matrix) Read by the Skinned Vertex Shader.
+    class Animator
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor
+         Animator(Scheduler & scheduler, Skeleton const & skeleton, std::vector<Clip> const & clips);
+        ~Animator();
+
+        // Public Member Functions
+        unsigned int add(unsigned int clip);
+        Character &  character(unsigned int index) { return mCharacters[index]; }
+        void update(float dt);
+        void upload();
+        void bind(GLuint shader, unsigned int character, GLuint unit) const;
+
+    private:
+
+        // Disable Copying and Assignment
+        Animator(Animator const &) = delete;
+        Animator & operator=(Animator const &) = delete;
+
+        // Private Member Containers
+        std::vector<Character> mCharacters;
+        std::vector<glm::vec4> mPalettes;
+
+        // Private Member Variables
+        Scheduler & mScheduler;
+        Skeleton const & mSkeleton;
+        std::vector<Clip> const & mClips;
+        GLuint mBuffer;
+        GLuint mTexture;
+
+    };
+};
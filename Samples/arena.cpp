@@ -0,0 +1,56 @@
+// Local Headers
+#include "arena.hpp"
+
+// Standard Headers
+#include <cstdint>
+#include <new>
+
+// Define Namespace
+namespace Mirage
+{
+    Arena::Arena(std::size_t capacity)
+        : mMemory(static_cast<char *>(::operator new(capacity)))
+        , mCapacity(capacity)
+        , mUsed(0)
+    {}
+
+    Arena::~Arena()
+    {
+        for (auto &i : mSpills) ::operator delete(i);
+        ::operator delete(mMemory);
+    }
+
+    void * Arena::allocate(std::size_t size, std::size_t alignment)
+    {
+        // Reserve Room to Align Inside the Claimed Range Without a Second Atomic
+        std::size_t claim = size + alignment - 1;
+        std::size_t offset = mUsed.fetch_add(claim, std::memory_order_relaxed);
+        if (offset + claim <= mCapacity)
+        {
+            std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mMemory + offset);
+            return reinterpret_cast<void *>((address + alignment - 1) & ~std::uintptr_t(alignment - 1));
+        }
+
+        // Out of Room; Spill to the Heap and Let reset() Grow the Arena
+        std::lock_guard<std::mutex> lock(mMutex);
+        mSpills.push_back(::operator new(claim));
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mSpills.back());
+        return reinterpret_cast<void *>((address + alignment - 1) & ~std::uintptr_t(alignment - 1));
+    }
+
+    void Arena::reset()
+    {
+        // Usage Keeps Counting Past the Capacity, so it Measures True Demand
+        std::size_t used = mUsed.load(std::memory_order_relaxed);
+        if (used > mHighWater) mHighWater = used;
+
+        if (!mSpills.empty())
+        {
+            for (auto &i : mSpills) ::operator delete(i);
+            mSpills.clear();
+            ::operator delete(mMemory);
+            mCapacity = mHighWater + mHighWater / 4;
+            mMemory = static_cast<char *>(::operator new(mCapacity));
+        }   mUsed.store(0, std::memory_order_relaxed);
+    }
+};
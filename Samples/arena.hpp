@@ -0,0 +1,115 @@
+#pragma once
+
+// Standard Headers
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Bump Allocator for Data that Lives for a Single Frame. Allocation is a
+    // Single Atomic Add, so Jobs May Share an Arena; Memory is Only Released
+    // All at Once by reset(). Overflow Spills to the Heap, and the Next reset()
+    // Grows the Arena to the High-Water Mark so Steady Frames Never malloc.
+    class Arena
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor
+        explicit Arena(std::size_t capacity);
+        ~Arena();
+
+        // Public Member Functions
+        void * allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+        void   reset();
+
+        // Statistics
+        std::size_t capacity()  const { return mCapacity; }
+        std::size_t used()      const { return mUsed.load(std::memory_order_relaxed); }
+        std::size_t highWater() const { return mHighWater; }
+        std::size_t spills()    const { return mSpills.size(); }
+
+    private:
+
+        // Disable Copying and Assignment
+        Arena(Arena const &) = delete;
+        Arena & operator=(Arena const &) = delete;
+
+        // Private Member Containers
+        std::vector<void *> mSpills;
+
+        // Private Member Variables
+        std::mutex  mMutex;
+        char *      mMemory;
+        std::size_t mCapacity;
+        std::size_t mHighWater = 0;
+        std::atomic<std::size_t> mUsed;
+
+    };
+
+    // One Arena per Frame in Flight; advance() Moves to the Oldest Frame's
+    // Arena and Resets It, so Data Handed to a Render Thread Stays Valid
+    class FrameArenas
+    {
+    public:
+
+        // Implement Custom Constructor
+        explicit FrameArenas(std::size_t capacity, unsigned int frames = 3)
+        {
+            for (unsigned int i = 0; i < frames; i++) mArenas.emplace_back(new Arena(capacity));
+        }
+
+        // Public Member Functions
+        Arena & current() { return * mArenas[mCurrent]; }
+        void    advance() { mCurrent = (mCurrent + 1) % mArenas.size(); mArenas[mCurrent]->reset(); }
+        std::size_t highWater() const
+        {
+            std::size_t water = 0;
+            for (auto &i : mArenas) water = (i->highWater() > water) ? i->highWater() : water;
+            return water;
+        }
+
+    private:
+
+        // Private Member Containers
+        std::vector<std::unique_ptr<Arena>> mArenas;
+
+        // Private Member Variables
+        unsigned int mCurrent = 0;
+
+    };
+
+    // Standard Library Allocator Drawing from an Arena; Deallocation is a No-Op
+    template<typename T> class ArenaAllocator
+    {
+    public:
+
+        typedef T value_type;
+
+        // Implement Custom Constructors
+        ArenaAllocator(Arena & arena) : mArena(& arena) {}
+        template<typename U> ArenaAllocator(ArenaAllocator<U> const & other) : mArena(other.arena()) {}
+
+        // Public Member Functions
+        T *  allocate(std::size_t n) { return static_cast<T *>(mArena->allocate(n * sizeof(T), alignof(T))); }
+        void deallocate(T *, std::size_t) {}
+        Arena * arena() const { return mArena; }
+
+    private:
+
+        // Private Member Variables
+        Arena * mArena;
+
+    };
+
+    template<typename T, typename U>
+    bool operator==(ArenaAllocator<T> const & a, ArenaAllocator<U> const & b) { return a.arena() == b.arena(); }
+    template<typename T, typename U>
+    bool operator!=(ArenaAllocator<T> const & a, ArenaAllocator<U> const & b) { return a.arena() != b.arena(); }
+
+    // Vector Whose Storage Comes from a Frame Arena
+    template<typename T> using FrameVector = std::vector<T, ArenaAllocator<T>>;
+};
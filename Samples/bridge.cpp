@@ -0,0 +1,141 @@
+// Local Headers
+#include "bridge.hpp"
+
+// Standard Headers
+#include <cstdio>
+
+// Define Namespace
+namespace Mirage
+{
+    void Bridge::State::setWorldTransform(btTransform const & transform)
+    {
+        // Awake Bodies at Rest are Still Reported Until they Fall Asleep
+        if (transform == mTransform) return;
+        mTransform = transform;
+        mBridge.write(mSlot, transform);
+    }
+
+    Bridge::Bridge(std::size_t capacity)
+        : mLatest(capacity)
+        , mFrames(capacity, 0)
+        , mMoved(capacity)
+        , mDirect(capacity, 0)
+        , mListed(capacity, 0)
+        , mMovers(capacity)
+        , mCapacity(capacity)
+        , mCount(0)
+    {
+        // Ranges Bound to a Storage Block Must Start on this Alignment
+        GLint alignment;
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, & alignment);
+        GLintptr size = GLintptr(capacity * sizeof(glm::mat4));
+        mStride = (size + alignment - 1) / alignment * alignment;
+        for (auto &i : mFences) i = nullptr;
+        mStates.reserve(capacity);
+        mActive.reserve(capacity);
+
+        // Coherent Persistent Mapping: Stores Reach the GPU with No Unmap or Flush
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glGenBuffers(1, & mBuffer);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, mBuffer);
+        glBufferStorage(GL_SHADER_STORAGE_BUFFER, mStride * kSegments, nullptr, flags);
+        mMapped = static_cast<unsigned char *>(glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, mStride * kSegments, flags));
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        if (mMapped == nullptr) fprintf(stderr, "Failed to Map Transform Bridge\n");
+    }
+
+    Bridge::~Bridge()
+    {
+        for (auto &i : mFences) if (i) glDeleteSync(i);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, mBuffer);
+        if (mMapped) glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        glDeleteBuffers(1, & mBuffer);
+    }
+
+    Bridge::State * Bridge::add(btTransform const & transform)
+    {
+        if (mStates.size() == mCapacity)
+        {
+            fprintf(stderr, "Transform Bridge Full: %lu Slots\n", static_cast<unsigned long>(mCapacity));
+            return nullptr;
+        }
+
+        // A New Slot Counts as Moved, so Every Segment Receives it
+        GLuint slot = GLuint(mStates.size());
+        mStates.push_back(std::unique_ptr<State>(new State(* this, slot, transform)));
+        write(slot, transform);
+        return mStates.back().get();
+    }
+
+    void Bridge::begin()
+    {
+        // Wait Until the GPU Has Finished with the Segment We're About to Reuse
+        if (mMapped == nullptr) return;
+        mSegment = (mSegment + 1) % kSegments;
+        if (mFences[mSegment])
+        {
+            glClientWaitSync(mFences[mSegment], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(mFences[mSegment]);
+            mFences[mSegment] = nullptr;
+        }
+        mOpen = reinterpret_cast<glm::mat4 *>(mMapped + mSegment * mStride);
+    }
+
+    void Bridge::write(GLuint slot, btTransform const & transform)
+    {
+        // Both are Column-Major, so the Matrix Goes Straight into the Mapped Segment
+        btScalar matrix[16];
+        transform.getOpenGLMatrix(matrix);
+        float * latest = & mLatest[slot][0][0];
+        for (int i = 0; i < 16; i++) latest[i] = float(matrix[i]);
+        if (mOpen) mOpen[slot] = mLatest[slot];
+        mDirect[slot] = mOpen != nullptr;
+
+        // Queue Each Slot Once per Frame; Islands May Report from Several Threads
+        if (!mMoved[slot].exchange(true))
+            mMovers[mCount.fetch_add(1)] = slot;
+    }
+
+    void Bridge::copy(GLuint slot)
+    {
+        mOpen[slot] = mLatest[slot];
+    }
+
+    void Bridge::end()
+    {
+        if (mOpen == nullptr) return;
+
+        // Movers Reported Outside begin() and end() Haven't Reached this Segment Yet
+        std::uint32_t count = mCount.exchange(0);
+        for (std::uint32_t i = 0; i < count; i++)
+        {
+            GLuint slot = mMovers[i];
+            mMoved[slot] = false;
+            mFrames[slot] = mFrame;
+            if (!mDirect[slot]) copy(slot);
+            mDirect[slot] = 0;
+            if (!mListed[slot]) { mListed[slot] = 1; mActive.push_back(slot); }
+        }
+
+        // Bodies that Moved in the Last Few Frames are Stale in this Segment;
+        // Once Every Segment Has Them they Drop Off Until they Move Again
+        std::size_t kept = 0;
+        for (GLuint slot : mActive)
+        {
+            std::uint32_t age = mFrame - mFrames[slot];
+            if (age > 0) copy(slot);
+            if (age + 1 < kSegments) mActive[kept++] = slot;
+            else mListed[slot] = 0;
+        }
+
+        mActive.resize(kept);
+        mOpen = nullptr;
+        mFrame++;
+    }
+
+    void Bridge::fence()
+    {
+        mFences[mSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+};
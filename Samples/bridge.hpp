@@ -0,0 +1,105 @@
+#pragma once
+
+// System Headers
+#include <btBulletDynamicsCommon.h>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Hands Rigid Body Transforms to the Renderer Without a Per-Body Pass.
+    // Each Body Gets a Motion State Bound to a Slot in a Persistently Mapped
+    // std430 Array of Model Matrices (See bridge.vert). Bullet Only Calls
+    // setWorldTransform for Awake Bodies, and Unchanged Ones are Skipped, so
+    // a Frame Only Touches What Moved. The Buffer Holds One Segment per Frame
+    // in Flight; a Body that Moved is Copied into the Next Segments Too, Until
+    // Every Segment Has Caught Up. Needs OpenGL 4.4 for glBufferStorage.
+    class Bridge
+    {
+    public:
+
+        // Segments Should Match the Number of Frames in Flight
+        static const unsigned int kSegments = 3;
+
+        // Motion State Writing into One Slot of the Bridge
+        class State : public btMotionState
+        {
+        public:
+
+            // Implement Custom Constructor
+            State(Bridge & bridge, GLuint slot, btTransform const & transform)
+                : mBridge(bridge), mSlot(slot), mTransform(transform) {}
+
+            // Public Member Functions
+            GLuint slot() const { return mSlot; }
+            void getWorldTransform(btTransform & transform) const override { transform = mTransform; }
+            void setWorldTransform(btTransform const & transform) override;
+
+        private:
+
+            // Private Member Variables
+            Bridge & mBridge;
+            GLuint mSlot;
+            btTransform mTransform;
+
+        };
+
+        // Implement Custom Constructor and Destructor
+        explicit Bridge(std::size_t capacity);
+        ~Bridge();
+
+        // Create a State to Pass to Physics::add(); Null When Full
+        State * add(btTransform const & transform);
+
+        // Call begin(), Step Physics, end(), Draw, then fence()
+        void begin();
+        void end();
+        void fence();
+        void bind(GLuint binding) const
+        { glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, mBuffer, offset(), mCapacity * sizeof(glm::mat4)); }
+
+        // Public Member Functions
+        GLuint buffer() const { return mBuffer; }
+        GLintptr offset() const { return mSegment * mStride; }
+        std::size_t size() const { return mStates.size(); }
+
+    private:
+
+        // Disable Copying and Assignment
+        Bridge(Bridge const &) = delete;
+        Bridge & operator=(Bridge const &) = delete;
+
+        // Private Member Functions
+        void write(GLuint slot, btTransform const & transform);
+        void copy(GLuint slot);
+
+        // Private Member Containers
+        std::vector<std::unique_ptr<State>> mStates;
+        std::vector<glm::mat4> mLatest;
+        std::vector<std::uint32_t> mFrames;
+        std::vector<std::atomic<bool>> mMoved;
+        std::vector<unsigned char> mDirect;
+        std::vector<unsigned char> mListed;
+        std::vector<GLuint> mMovers;
+        std::vector<GLuint> mActive;
+
+        // Private Member Variables
+        GLuint   mBuffer;
+        GLsync   mFences[kSegments];
+        GLintptr mStride;
+        std::size_t mCapacity;
+        std::atomic<std::uint32_t> mCount;
+        std::uint32_t mFrame = 0;
+        unsigned int mSegment = 0;
+        unsigned char * mMapped = nullptr;
+        glm::mat4 * mOpen = nullptr;
+
+    };
+};
@@ -0,0 +1,93 @@
+// Local Headers
+#include "physics.hpp"
+
+// Standard Headers
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Moves Boxes Through Each Broadphase Directly, with No Narrowphase or
+// Solver, and Times setAabb() Plus calculateOverlappingPairs() per Frame
+// for Growing Body Counts Under Three Kinds of Motion:
+//
+//     rest     One Body in Twenty Jitters, Like a Mostly Sleeping Scene
+//     jitter   Every Body Jitters in Place, Like a Settling Pile
+//     cross    Half Drift One Way Along x and Half the Other Way
+//
+//     broadphase_benchmark [max bodies] [frames]
+typedef std::chrono::high_resolution_clock Clock;
+
+enum Motion { Rest, Jitter, Cross };
+static char const * kMotions[] = { "rest", "jitter", "cross" };
+static char const * kBroadphases[] = { "dbvt", "sweep16", "sweep32", "sap" };
+
+int main(int argc, char * argv[])
+{
+    int most = (argc > 1) ? std::atoi(argv[1]) : 64000;
+    int frames = (argc > 2) ? std::atoi(argv[2]) : 60;
+    const btVector3 half(0.5f, 0.5f, 0.5f);
+    fprintf(stdout, "frames: %d\n", frames);
+    fprintf(stdout, "\n%-8s %-8s %-10s %12s %10s\n", "bodies", "motion", "broadphase", "update (ms)", "pairs");
+
+    for (int bodies = 1000; bodies <= most; bodies *= 4)
+    for (int motion = Rest; motion <= Cross; motion++)
+    for (int type = Mirage::DbvtBroadphase; type <= Mirage::SortAndSweepBroadphase; type++)
+    {
+        // btAxisSweep3 Indexes Handles with 16 Bits
+        if (type == Mirage::AxisSweepBroadphase && bodies > 16000)
+        {
+            fprintf(stdout, "%-8d %-8s %-10s %12s %10s\n", bodies, kMotions[motion], kBroadphases[type], "-", "-");
+            continue;
+        }
+
+        // Eight Units of Space per Unit Box Keeps Pairs Proportional to Bodies
+        float side = std::cbrt(bodies * 8.0f);
+        auto broadphase = Mirage::Physics::broadphase(Mirage::Broadphase(type), side);
+        std::mt19937 random(bodies);
+        std::uniform_real_distribution<float> place(-side / 2, side / 2), nudge(-0.02f, 0.02f);
+        std::vector<btVector3> positions(bodies);
+        std::vector<btBroadphaseProxy *> proxies(bodies);
+        for (int i = 0; i < bodies; i++)
+        {
+            positions[i] = btVector3(place(random), place(random), place(random));
+            proxies[i] = broadphase->createProxy(positions[i] - half, positions[i] + half, BOX_SHAPE_PROXYTYPE,
+                                                 nullptr, btBroadphaseProxy::DefaultFilter,
+                                                 btBroadphaseProxy::AllFilter, nullptr);
+        }
+        broadphase->calculateOverlappingPairs(nullptr);
+
+        double ms = 0.0;
+        std::vector<int> moved;
+        for (int f = 0; f < frames; f++)
+        {
+            // Move Outside the Timer so Only the Broadphase is Measured
+            moved.clear();
+            for (int i = 0; i < bodies; i++)
+            {
+                if (motion == Rest && i % 20 != 0) continue;
+                if (motion == Cross)
+                {
+                    float x = positions[i].x() + ((i % 2) ? 0.05f : -0.05f);
+                    if (x >  side / 2) x -= side;
+                    if (x < -side / 2) x += side;
+                    positions[i].setX(x);
+                }
+                else positions[i] += btVector3(nudge(random), nudge(random), nudge(random));
+                moved.push_back(i);
+            }
+
+            auto start = Clock::now();
+            for (int i : moved) broadphase->setAabb(proxies[i], positions[i] - half, positions[i] + half, nullptr);
+            broadphase->calculateOverlappingPairs(nullptr);
+            ms += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        int pairs = broadphase->getOverlappingPairCache()->getNumOverlappingPairs();
+        fprintf(stdout, "%-8d %-8s %-10s %12.3f %10d\n", bodies, kMotions[motion], kBroadphases[type], ms / frames, pairs);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,213 @@
+// Local Headers
+#include "clusters.hpp"
+
+// Standard Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
+// Define Namespace
+namespace Mirage
+{
+    // Light Indices are Uploaded as GL_R16UI
+    static const std::size_t kMaxLights = 65536;
+
+    static void upload(GLuint buffer, void const * data, std::size_t size)
+    {
+        // Respecifying the Store Orphans Last Frame's Data Instead of Stalling
+        glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+        glBufferData(GL_TEXTURE_BUFFER, size ? size : 16, size ? data : nullptr, GL_STREAM_DRAW);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    Clusters::Clusters()
+        : mScale(1.0f), mTile(1.0f), mNear(0.1f), mFar(100.0f), mSliceScale(0.0f), mSliceBias(0.0f)
+    {
+        // Lights Take Three Texels; Clusters an Offset and Count into the Indices
+        GLenum formats[] = { GL_RGBA32F, GL_RG32UI, GL_R16UI };
+        glGenBuffers(3, mBuffers);
+        glGenTextures(3, mTextures);
+        for (int i = 0; i < 3; i++)
+        {
+            upload(mBuffers[i], nullptr, 0);
+            glBindTexture(GL_TEXTURE_BUFFER, mTextures[i]);
+            glTexBuffer(GL_TEXTURE_BUFFER, formats[i], mBuffers[i]);
+        }
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+    }
+
+    Clusters::~Clusters()
+    {
+        glDeleteTextures(3, mTextures);
+        glDeleteBuffers(3, mBuffers);
+    }
+
+    void Clusters::project(glm::mat4 const & projection, float near, float far, int width, int height)
+    {
+        // Slice k Starts at near * (far / near)^(k / kSlices), so log(depth) Finds it
+        mScale = glm::vec2(projection[0][0], projection[1][1]);
+        mTile = glm::vec2(width / float(kTilesX), height / float(kTilesY));
+        mNear = near;
+        mFar = far;
+        mSliceScale = kSlices / std::log(far / near);
+        mSliceBias = -mSliceScale * std::log(near);
+        for (unsigned int k = 0; k <= kSlices; k++)
+            mDepths[k] = near * std::pow(far / near, k / float(kSlices));
+
+        // A Tile's Sides Fan Out with Depth; Bound them at Both Ends of the Slice
+        for (unsigned int k = 0; k < kSlices; k++)
+        {
+            float front = mDepths[k], back = mDepths[k + 1];
+            for (unsigned int i = 0; i < kTilesX; i++)
+            {
+                float lower = -1.0f + 2.0f * i / kTilesX, upper = -1.0f + 2.0f * (i + 1) / kTilesX;
+                mMinX[k][i] = std::min(lower * front, lower * back) / mScale.x;
+                mMaxX[k][i] = std::max(upper * front, upper * back) / mScale.x;
+            }
+            for (unsigned int j = 0; j < kTilesY; j++)
+            {
+                float lower = -1.0f + 2.0f * j / kTilesY, upper = -1.0f + 2.0f * (j + 1) / kTilesY;
+                mMinY[k][j] = std::min(lower * front, lower * back) / mScale.y;
+                mMaxY[k][j] = std::max(upper * front, upper * back) / mScale.y;
+            }
+        }
+    }
+
+    unsigned int Clusters::slice(float depth) const
+    {
+        float k = std::floor(std::log(depth) * mSliceScale + mSliceBias);
+        return unsigned(std::min(std::max(k, 0.0f), kSlices - 1.0f));
+    }
+
+    void Clusters::assign(std::vector<Light> const & lights, glm::mat4 const & view)
+    {
+        std::size_t count = lights.size();
+        if (count > kMaxLights)
+        {
+            fprintf(stderr, "Too Many Lights: %lu\n", static_cast<unsigned long>(count));
+            count = kMaxLights;
+        }
+
+        mTexels.resize(count * 3);
+        mPairs.clear();
+        mRanges.assign(kClusters * 2, 0);
+        for (std::size_t l = 0; l < count; l++)
+        {
+            // Lights are Shaded in View Space
+            Light const & light = lights[l];
+            glm::vec3 position = glm::vec3(view * glm::vec4(light.position, 1.0f));
+            glm::vec3 direction = glm::normalize(glm::vec3(view * glm::vec4(light.direction, 0.0f)));
+            mTexels[l * 3 + 0] = glm::vec4(position, light.radius);
+            mTexels[l * 3 + 1] = glm::vec4(light.color, light.inner);
+            mTexels[l * 3 + 2] = glm::vec4(direction, light.outer);
+
+            // Narrower Cones Fit a Smaller Sphere than their Full Radius
+            glm::vec3 center = position;
+            float radius = light.radius;
+            if (light.outer > std::sqrt(0.5f))
+            {
+                radius = light.radius / (2.0f * light.outer);
+                center = position + direction * radius;
+            }
+            else if (light.outer > 0.0f)
+            {
+                radius = light.radius * std::sqrt(1.0f - light.outer * light.outer);
+                center = position + direction * (light.radius * light.outer);
+            }
+
+            // Depth Runs Down -z; Skip Lights Entirely Outside the Slices
+            float depth = -center.z;
+            if (depth + radius < mNear || depth - radius > mFar) continue;
+            unsigned int s0 = slice(std::max(depth - radius, mNear)), s1 = slice(std::min(depth + radius, mFar));
+
+            // Project the Sphere's Box to Narrow the Tiles; Wherever it Crosses
+            // the Near Plane it Could Cover the Whole Screen
+            unsigned int c0 = 0, c1 = kTilesX - 1, r0 = 0, r1 = kTilesY - 1;
+            if (depth - radius > mNear)
+            {
+                float front = depth - radius, back = depth + radius;
+                auto tiles = [](float lower, float upper, unsigned int size, unsigned int & first, unsigned int & last) {
+                    first = unsigned(std::min(std::max((lower * 0.5f + 0.5f) * size, 0.0f), size - 1.0f));
+                    last  = unsigned(std::min(std::max((upper * 0.5f + 0.5f) * size, 0.0f), size - 1.0f));
+                };
+                tiles(std::min((center.x - radius) / front, (center.x - radius) / back) * mScale.x,
+                      std::max((center.x + radius) / front, (center.x + radius) / back) * mScale.x, kTilesX, c0, c1);
+                tiles(std::min((center.y - radius) / front, (center.y - radius) / back) * mScale.y,
+                      std::max((center.y + radius) / front, (center.y + radius) / back) * mScale.y, kTilesY, r0, r1);
+            }
+
+            // Squared Distance from the Center to Each Cluster's Box; Rows Share
+            // y and z, so Only x Differs Across the Four Lanes
+            for (unsigned int s = s0; s <= s1; s++)
+            {
+                float dz = std::max(std::max(mDepths[s] - depth, depth - mDepths[s + 1]), 0.0f);
+                for (unsigned int row = r0; row <= r1; row++)
+                {
+                    float dy = std::max(std::max(mMinY[s][row] - center.y, center.y - mMaxY[s][row]), 0.0f);
+                    float rest = radius * radius - dy * dy - dz * dz;
+                    if (rest < 0.0f) continue;
+
+                    std::uint32_t base = (s * kTilesY + row) * kTilesX;
+                    for (unsigned int col = c0 & ~3u; col <= c1; col += 4)
+                    {
+#if defined(__SSE2__) || defined(_M_X64)
+                        __m128 x = _mm_set1_ps(center.x);
+                        __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(& mMinX[s][col]), x),
+                                                          _mm_sub_ps(x, _mm_loadu_ps(& mMaxX[s][col]))),
+                                               _mm_setzero_ps());
+                        int mask = _mm_movemask_ps(_mm_cmple_ps(_mm_mul_ps(dx, dx), _mm_set1_ps(rest)));
+#else
+                        int mask = 0;
+                        for (unsigned int b = 0; b < 4; b++)
+                        {
+                            float dx = std::max(std::max(mMinX[s][col + b] - center.x, center.x - mMaxX[s][col + b]), 0.0f);
+                            if (dx * dx <= rest) mask |= 1 << b;
+                        }
+#endif
+                        for (unsigned int b = 0; b < 4; b++)
+                        {
+                            if (!(mask & (1 << b)) || col + b < c0 || col + b > c1) continue;
+                            std::uint32_t cluster = base + col + b;
+                            mPairs.push_back(cluster << 16 | std::uint32_t(l));
+                            mRanges[cluster * 2 + 1]++;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Counts to Offsets, then Scatter Each Light into its Cluster's Range
+        GLuint offset = 0;
+        mCursors.resize(kClusters);
+        for (unsigned int c = 0; c < kClusters; c++)
+        {
+            mRanges[c * 2] = mCursors[c] = offset;
+            offset += mRanges[c * 2 + 1];
+        }
+
+        mIndices.resize(mPairs.size());
+        for (auto pair : mPairs) mIndices[mCursors[pair >> 16]++] = std::uint16_t(pair & 0xFFFF);
+
+        upload(mBuffers[0], mTexels.data(), mTexels.size() * sizeof(glm::vec4));
+        upload(mBuffers[1], mRanges.data(), mRanges.size() * sizeof(GLuint));
+        upload(mBuffers[2], mIndices.data(), mIndices.size() * sizeof(std::uint16_t));
+    }
+
+    void Clusters::bind(GLuint shader, GLuint unit) const
+    {
+        char const * names[] = { "lights", "clusters", "indices" };
+        for (GLuint i = 0; i < 3; i++)
+        {
+            glActiveTexture(GL_TEXTURE0 + unit + i);
+            glBindTexture(GL_TEXTURE_BUFFER, mTextures[i]);
+            glUniform1i(glGetUniformLocation(shader, names[i]), GLint(unit + i));
+        }
+
+        glUniform3ui(glGetUniformLocation(shader, "cluster_grid"), kTilesX, kTilesY, kSlices);
+        glUniform2f(glGetUniformLocation(shader, "tile_size"), mTile.x, mTile.y);
+        glUniform2f(glGetUniformLocation(shader, "slice_scale_bias"), mSliceScale, mSliceBias);
+    }
+};
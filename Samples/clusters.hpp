@@ -0,0 +1,87 @@
+#pragma once
+
+// System Headers
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <cstdint>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Point or Spot Light in World Space. Cones are Cosines of the Half
+    // Angles; the Defaults Light Every Direction, Making a Point Light.
+    struct Light {
+        glm::vec3 position;
+        float     radius;
+        glm::vec3 color;
+        float     inner = -1.0f;
+        glm::vec3 direction = glm::vec3(0.0f, 0.0f, -1.0f);
+        float     outer = -2.0f;
+    };
+
+    // Clustered Forward Lighting: the View Frustum is Cut into a Grid of
+    // Screen Tiles by Exponentially Spaced Depth Slices. assign() Bounds Each
+    // Light with a Sphere and Tests it Against Four Clusters of a Row at Once
+    // with SSE, then Uploads Lights, Per-Cluster Ranges and Light Indices as
+    // Texture Buffers; clustered.frag Only Loops Over its Own Cluster's Lights.
+    // Assumes a Symmetric Perspective Projection.
+    class Clusters
+    {
+    public:
+
+        // Grid Size; Columns Stay a Multiple of Four for the SIMD Rows
+        static const unsigned int kTilesX = 16;
+        static const unsigned int kTilesY = 12;
+        static const unsigned int kSlices = 24;
+        static const unsigned int kClusters = kTilesX * kTilesY * kSlices;
+
+        // Implement Custom Constructor and Destructor
+         Clusters();
+        ~Clusters();
+
+        // Rebuild Cluster Bounds Whenever the Projection or Viewport Changes
+        void project(glm::mat4 const & projection, float near, float far, int width, int height);
+
+        // Public Member Functions
+        void assign(std::vector<Light> const & lights, glm::mat4 const & view);
+        void bind(GLuint shader, GLuint unit) const;
+        std::size_t references() const { return mIndices.size(); }
+
+    private:
+
+        // Disable Copying and Assignment
+        Clusters(Clusters const &) = delete;
+        Clusters & operator=(Clusters const &) = delete;
+
+        // Private Member Functions
+        unsigned int slice(float depth) const;
+
+        // Private Member Containers
+        std::vector<glm::vec4> mTexels;
+        std::vector<std::uint32_t> mPairs;
+        std::vector<GLuint> mRanges;
+        std::vector<GLuint> mCursors;
+        std::vector<std::uint16_t> mIndices;
+
+        // View-Space Cluster Bounds; Columns Vary Only in x, Rows Only in y
+        float mMinX[kSlices][kTilesX];
+        float mMaxX[kSlices][kTilesX];
+        float mMinY[kSlices][kTilesY];
+        float mMaxY[kSlices][kTilesY];
+        float mDepths[kSlices + 1];
+
+        // Private Member Variables
+        glm::vec2 mScale;
+        glm::vec2 mTile;
+        float  mNear;
+        float  mFar;
+        float  mSliceScale;
+        float  mSliceBias;
+        GLuint mBuffers[3];
+        GLuint mTextures[3];
+
+    };
+};
@@ -0,0 +1,107 @@
+// Local Headers
+#include "debug.hpp"
+
+// Standard Headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+
+// Define Namespace
+namespace Mirage
+{
+    // Length of the Normal Drawn at Each Contact
+    static const btScalar kContactLength = btScalar(0.1f);
+
+    DebugDraw::DebugDraw(int mode)
+        : mMode(mode)
+    {
+        mShader.attach("debug.vert").attach("debug.frag").link();
+        glGenVertexArrays(1, & mVertexArray);
+        glGenBuffers(1, & mVertexBuffer);
+
+        // Set Shader Attributes
+        glBindVertexArray(mVertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLvoid *) offsetof(Vertex, position));
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLvoid *) offsetof(Vertex, color));
+        glEnableVertexAttribArray(0); // Vertex Positions
+        glEnableVertexAttribArray(1); // Vertex Colors
+        glBindVertexArray(0);
+
+        // Start from a Color pack() Can Never Produce
+        mColor = btVector3(-1.0f, -1.0f, -1.0f);
+        mPacked = 0;
+    }
+
+    DebugDraw::~DebugDraw()
+    {
+        glDeleteBuffers(1, & mVertexBuffer);
+        glDeleteVertexArrays(1, & mVertexArray);
+    }
+
+    GLuint DebugDraw::pack(btVector3 const & color)
+    {
+        // Bullet Emits Long Runs in One Color; Skip Repacking Them
+        if (color == mColor) return mPacked;
+        auto channel = [](btScalar c) {
+            return GLuint(std::min(std::max(float(c), 0.0f), 1.0f) * 255.0f + 0.5f);
+        };
+
+        mColor = color;
+        mPacked = channel(color.x()) | channel(color.y()) << 8 | channel(color.z()) << 16 | 0xFF000000u;
+        return mPacked;
+    }
+
+    void DebugDraw::drawLine(btVector3 const & from, btVector3 const & to, btVector3 const & color)
+    {
+        GLuint packed = pack(color);
+        mVertices.push_back(Vertex { glm::vec3(from.x(), from.y(), from.z()), packed });
+        mVertices.push_back(Vertex { glm::vec3(to.x(), to.y(), to.z()), packed });
+    }
+
+    void DebugDraw::drawLine(btVector3 const & from, btVector3 const & to,
+                             btVector3 const & fromColor, btVector3 const & toColor)
+    {
+        mVertices.push_back(Vertex { glm::vec3(from.x(), from.y(), from.z()), pack(fromColor) });
+        mVertices.push_back(Vertex { glm::vec3(to.x(), to.y(), to.z()), pack(toColor) });
+    }
+
+    void DebugDraw::drawContactPoint(btVector3 const & point, btVector3 const & normal, btScalar distance,
+                                     int lifetime, btVector3 const & color)
+    {
+        // Draw the Normal, Plus the Penetration Depth When the Bodies Overlap
+        (void) lifetime;
+        drawLine(point, point + normal * kContactLength, color);
+        if (distance < btScalar(0)) drawLine(point, point + normal * distance, color);
+    }
+
+    void DebugDraw::reportErrorWarning(char const * warning)
+    {
+        fprintf(stderr, "Bullet: %s\n", warning);
+    }
+
+    void DebugDraw::draw3dText(btVector3 const & location, char const * text)
+    {
+        // No Text Rendering; Mark the Spot Instead
+        (void) text;
+        btVector3 color(1.0f, 1.0f, 1.0f);
+        drawLine(location - btVector3(kContactLength, 0.0f, 0.0f), location + btVector3(kContactLength, 0.0f, 0.0f), color);
+        drawLine(location - btVector3(0.0f, kContactLength, 0.0f), location + btVector3(0.0f, kContactLength, 0.0f), color);
+    }
+
+    void DebugDraw::draw(glm::mat4 const & viewProjection)
+    {
+        if (mVertices.empty()) return;
+
+        // Respecifying the Store Orphans Last Frame's Lines Instead of Stalling
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, mVertices.size() * sizeof(Vertex), mVertices.data(), GL_STREAM_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        mShader.activate().bind("view_projection", viewProjection);
+        glBindVertexArray(mVertexArray);
+        glDrawArrays(GL_LINES, 0, GLsizei(mVertices.size()));
+        glBindVertexArray(0);
+        mVertices.clear();
+    }
+};
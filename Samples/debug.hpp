@@ -0,0 +1,73 @@
+#pragma once
+
+// Local Headers
+#include "shader.hpp"
+
+// System Headers
+#include <btBulletDynamicsCommon.h>
+#include <LinearMath/btIDebugDraw.h>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Physics Debug Renderer: Every Line Bullet Emits During debugDrawWorld()
+    // Lands in One CPU Vertex Stream, and draw() Uploads it Through an Orphaned
+    // Buffer and Issues a Single GL_LINES Call. The Stream Keeps its Capacity
+    // Between Frames, so a Steady Frame of 100k+ Lines Doesn't Allocate.
+    class DebugDraw : public btIDebugDraw
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor
+         DebugDraw(int mode = DBG_DrawWireframe | DBG_DrawContactPoints);
+        ~DebugDraw();
+
+        // Implement btIDebugDraw
+        void drawLine(btVector3 const & from, btVector3 const & to, btVector3 const & color) override;
+        void drawLine(btVector3 const & from, btVector3 const & to,
+                      btVector3 const & fromColor, btVector3 const & toColor) override;
+        void drawContactPoint(btVector3 const & point, btVector3 const & normal, btScalar distance,
+                              int lifetime, btVector3 const & color) override;
+        void reportErrorWarning(char const * warning) override;
+        void draw3dText(btVector3 const & location, char const * text) override;
+        void setDebugMode(int mode) override { mMode = mode; }
+        int  getDebugMode() const override { return mMode; }
+        void clearLines() override { mVertices.clear(); }
+
+        // Draw Everything Accumulated Since the Last Call, then Start Over
+        void draw(glm::mat4 const & viewProjection);
+        std::size_t lines() const { return mVertices.size() / 2; }
+
+    private:
+
+        // Disable Copying and Assignment
+        DebugDraw(DebugDraw const &) = delete;
+        DebugDraw & operator=(DebugDraw const &) = delete;
+
+        // Positions Plus Colors Packed as Normalized RGBA8
+        struct Vertex {
+            glm::vec3 position;
+            GLuint color;
+        };
+
+        // Private Member Functions
+        GLuint pack(btVector3 const & color);
+
+        // Private Member Containers
+        std::vector<Vertex> mVertices;
+
+        // Private Member Variables
+        Shader mShader;
+        GLuint mVertexArray;
+        GLuint mVertexBuffer;
+        int    mMode;
+        btVector3 mColor;
+        GLuint mPacked;
+
+    };
+};
@@ -0,0 +1,141 @@
+// Local Headers
+#include "drawlist.hpp"
+#include "lod.hpp"
+
+// System Headers
+#include <glm/gtc/type_ptr.hpp>
+
+// Standard Headers
+#include <algorithm>
+
+// Define Namespace
+namespace Mirage
+{
+    DrawList::DrawList(Scheduler & scheduler)
+        : mCursors(scheduler.size())
+        , mScheduler(scheduler)
+    {}
+
+    std::size_t DrawList::size() const
+    {
+        std::size_t size = 0;
+        for (auto &i : mBuffers) size += i.size();
+        return size;
+    }
+
+    void DrawList::record(std::vector<Renderable> const & scene,
+                          glm::mat4 const & view, glm::mat4 const & projection, Arena & arena)
+    {
+        // Levels Persist Between Frames; Each Worker Only Touches its Own Slice
+        mLevels.resize(scene.size(), 0);
+        Frustum frustum(projection * view);
+
+        // Last Frame's Buffers Belong to an Arena that Has Since Been Reset
+        mBuffers.clear();
+        for (std::size_t i = 0; i < mCursors.size(); i++)
+            mBuffers.emplace_back(ArenaAllocator<DrawCommand>(arena));
+
+        // Each Job Records a Contiguous Slice into its Own Buffer
+        std::size_t slice = (scene.size() + mBuffers.size() - 1) / mBuffers.size();
+        mScheduler.parallel_for(mBuffers.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                record(scene, std::min(scene.size(), i * slice), std::min(scene.size(), (i + 1) * slice),
+                       frustum, view, projection, mBuffers[i]);
+        });
+    }
+
+    void DrawList::record(std::vector<Renderable> const & scene, std::size_t begin, std::size_t end,
+                          Frustum const & frustum, glm::mat4 const & view,
+                          glm::mat4 const & projection, FrameVector<DrawCommand> & commands)
+    {
+        // Reserve the Whole Slice Up Front; Growing Would Strand Copies in the Arena
+        commands.reserve(end - begin);
+        glm::mat4 view_projection = projection * view;
+        for (std::size_t i = begin; i < end; i++)
+        {
+            // Cull the World-Space Bounding Sphere
+            auto const & object = scene[i];
+            auto const & m = object.model;
+            glm::vec3 center = glm::vec3(m * glm::vec4(object.center, 1.0f));
+            float radius = object.radius * glm::max(glm::length(glm::vec3(m[0])),
+                                           glm::max(glm::length(glm::vec3(m[1])), glm::length(glm::vec3(m[2]))));
+            if (!frustum.visible(center, radius)) continue;
+
+            // Pick a Level by Projected Size, Stepping from Last Frame's Choice
+            glm::vec3 eye = glm::vec3(view * glm::vec4(center, 1.0f));
+            float depth = glm::max(-eye.z, 0.0f);
+            float size = radius * projection[1][1] / glm::max(glm::length(eye), radius);
+            unsigned int levels = std::max(object.levels, 1u);
+            unsigned int level = lod(std::min<unsigned int>(mLevels[i], levels - 1), levels, size);
+            mLevels[i] = level;
+
+            // Sort by Program, then Texture, then Vertex Array, then Front to Back
+            std::uint64_t quantized = std::min<std::uint64_t>(std::uint64_t(depth * 256.0f), 0xFFFFF);
+            std::uint64_t key = (std::uint64_t(object.program     & 0xFFF)  << 52)
+                              | (std::uint64_t(object.texture     & 0xFFFF) << 36)
+                              | (std::uint64_t(object.vertexArray & 0xFFFF) << 20)
+                              | quantized;
+            commands.push_back(DrawCommand { key, view_projection * m, m, object.program,
+                                             object.texture, object.vertexArray,
+                                             object.first[level], object.count[level], 0 });
+        }
+
+        std::sort(commands.begin(), commands.end(),
+            [](DrawCommand const & a, DrawCommand const & b) { return a.key < b.key; });
+    }
+
+    void DrawList::submit(UniformRing * objects)
+    {
+        // Stream Every Object Block Up Front; the Ring is Unmapped Before Drawing
+        if (objects)
+        {
+            objects->begin();
+            for (auto &i : mBuffers)
+            for (auto &c : i)
+            {
+                ObjectBlock block = { c.model, c.transform };
+                c.block = objects->push(& block, sizeof(block));
+            }   objects->end();
+        }
+
+        GLuint program = 0, texture = 0, vertexArray = 0;
+        GLint transform = -1, model = -1;
+        std::fill(mCursors.begin(), mCursors.end(), 0);
+        for (;;)
+        {
+            // Merge the Sorted Buffers by Always Taking the Smallest Head
+            std::size_t best = mBuffers.size();
+            for (std::size_t i = 0; i < mBuffers.size(); i++)
+                if (mCursors[i] < mBuffers[i].size() && (best == mBuffers.size() ||
+                    mBuffers[i][mCursors[i]].key < mBuffers[best][mCursors[best]].key)) best = i;
+            if (best == mBuffers.size()) break;
+            auto const & c = mBuffers[best][mCursors[best]++];
+
+            // The Ring Ran Out of Room for this Block; Skip the Draw for a Frame
+            if (objects && c.block < 0) continue;
+
+            // Only Touch State that Differs from the Previous Draw
+            if (c.program != program)
+            {
+                glUseProgram(program = c.program);
+                transform = glGetUniformLocation(program, "transform");
+                model     = glGetUniformLocation(program, "model");
+            }
+            if (c.texture != texture)
+            {
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, texture = c.texture);
+            }
+            if (c.vertexArray != vertexArray) glBindVertexArray(vertexArray = c.vertexArray);
+
+            if (objects) objects->bind(ObjectBinding, c.block, sizeof(ObjectBlock));
+            else
+            {
+                glUniformMatrix4fv(transform, 1, GL_FALSE, glm::value_ptr(c.transform));
+                glUniformMatrix4fv(model,     1, GL_FALSE, glm::value_ptr(c.model));
+            }
+            glDrawElements(GL_TRIANGLES, c.count, GL_UNSIGNED_INT, (GLvoid *) (c.first * sizeof(GLuint)));
+        }   glBindVertexArray(0);
+        if (objects) objects->fence();
+    }
+};
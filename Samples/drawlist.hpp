@@ -0,0 +1,86 @@
+#pragma once
+
+// Local Headers
+#include "arena.hpp"
+#include "frustum.hpp"
+#include "jobs.hpp"
+#include "uniforms.hpp"
+
+// System Headers
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <cstdint>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Scene Object as Seen by the Draw List; Ranges Index the Bound Element Buffer
+    struct Renderable {
+        glm::mat4 model;
+        glm::vec3 center;
+        float  radius;
+        GLuint program;
+        GLuint texture;
+        GLuint vertexArray;
+        GLuint levels;
+        GLuint first[5];
+        GLuint count[5];
+    };
+
+    // One Recorded Draw, Sorted by Key Before Replay
+    struct DrawCommand {
+        std::uint64_t key;
+        glm::mat4 transform;
+        glm::mat4 model;
+        GLuint program;
+        GLuint texture;
+        GLuint vertexArray;
+        GLuint first;
+        GLuint count;
+        GLintptr block;
+    };
+
+    // Records Draw Commands for Large Scenes Across Scheduler Jobs. Each
+    // Job Culls, Picks LODs, Computes Matrices and Sort Keys for a Slice
+    // of the Scene into its Own Command Buffer and Sorts It; the GL Thread
+    // Then Merges the Sorted Buffers and Replays Them with Minimal Rebinding.
+    // Command Buffers Come from the Frame Arena Passed to record(), so it Must
+    // Not be Reset Before submit(). Given a UniformRing, Matrices Go Through
+    // the Object Block Instead.
+    class DrawList
+    {
+    public:
+
+        // Implement Custom Constructor
+        explicit DrawList(Scheduler & scheduler);
+
+        // Public Member Functions
+        void record(std::vector<Renderable> const & scene,
+                    glm::mat4 const & view, glm::mat4 const & projection, Arena & arena);
+        void submit(UniformRing * objects = nullptr);
+        std::size_t size() const;
+
+    private:
+
+        // Disable Copying and Assignment
+        DrawList(DrawList const &) = delete;
+        DrawList & operator=(DrawList const &) = delete;
+
+        // Private Member Functions
+        void record(std::vector<Renderable> const & scene, std::size_t begin, std::size_t end,
+                    Frustum const & frustum, glm::mat4 const & view,
+                    glm::mat4 const & projection, FrameVector<DrawCommand> & commands);
+
+        // Private Member Containers
+        std::vector<FrameVector<DrawCommand>> mBuffers;
+        std::vector<unsigned char> mLevels;
+        std::vector<std::size_t> mCursors;
+
+        // Private Member Variables
+        Scheduler & mScheduler;
+
+    };
+};
@@ -0,0 +1,125 @@
+// Local Headers
+#include "entity.hpp"
+#include "transform.hpp"
+
+// Standard Headers
+#include <atomic>
+#include <cstdio>
+
+// Define Namespace
+namespace Mirage
+{
+    // Entities per Job in the Parallel Systems
+    static const std::size_t kGrain = 1024;
+
+    void Storage::insert(Entity entity)
+    {
+        std::uint32_t index = entity & kIndexMask;
+        if (index >= mSparse.size()) mSparse.resize(index + 1, ~0u);
+        mSparse[index] = std::uint32_t(mDense.size());
+        mDense.push_back(entity);
+    }
+
+    void Storage::erase(Entity entity)
+    {
+        // Move the Last Entity into the Hole so the Dense Array Stays Packed
+        std::uint32_t index = entity & kIndexMask, slot = mSparse[index];
+        Entity last = mDense.back();
+        mDense[slot] = last;
+        mSparse[last & kIndexMask] = slot;
+        mDense.pop_back();
+        mSparse[index] = ~0u;
+    }
+
+    void Storage::swap(std::size_t a, std::size_t b)
+    {
+        std::swap(mDense[a], mDense[b]);
+        mSparse[mDense[a] & kIndexMask] = std::uint32_t(a);
+        mSparse[mDense[b] & kIndexMask] = std::uint32_t(b);
+    }
+
+    std::size_t Registry::next()
+    {
+        static std::atomic<std::size_t> families(0);
+        return families++;
+    }
+
+    Entity Registry::create()
+    {
+        // Recycled Indices Already Carry their Bumped Version
+        if (mFree.empty() == false)
+        {
+            std::uint32_t index = mFree.back(); mFree.pop_back();
+            return mEntities[index];
+        }
+
+        if (mEntities.size() > Storage::kIndexMask)
+        {
+            fprintf(stderr, "Too Many Entities\n");
+            return kNullEntity;
+        }
+        mEntities.push_back(Entity(mEntities.size()));
+        return mEntities.back();
+    }
+
+    void Registry::destroy(Entity entity)
+    {
+        if (alive(entity) == false) return;
+        for (auto &i : mPools) if (i && i->contains(entity)) i->remove(entity);
+
+        std::uint32_t index = entity & Storage::kIndexMask;
+        std::uint32_t version = ((entity >> Storage::kIndexBits) + 1) & 0xFF;
+        mEntities[index] = (version << Storage::kIndexBits) | index;
+        mFree.push_back(index);
+    }
+
+    void sync(Registry & registry)
+    {
+        // Walks Only the Bodies, Which are Usually Far Fewer than the Transforms
+        registry.each<Body, Transform>([](Entity, Body & body, Transform & transform) {
+            if (body.moved == false) return;
+            transform.position = body.position;
+            transform.rotation = body.rotation;
+            transform.dirty = true;
+            body.moved = false;
+        });
+    }
+
+    void place(Registry & registry, Scheduler & scheduler)
+    {
+        // Each Job Writes Only the Renderables of its Own Entities
+        auto & renderables = registry.pool<Renderable>();
+        registry.each<Transform>(scheduler, kGrain, [&renderables](Entity entity, Transform & transform) {
+            if (transform.dirty == false) return;
+            transform.world = Transforms::compose(transform.position, transform.rotation, transform.scale);
+            transform.dirty = false;
+            if (renderables.contains(entity)) renderables.get(entity).model = transform.world;
+        });
+    }
+
+    void cull(Registry & registry, Scheduler & scheduler, Frustum const & frustum,
+              std::vector<Entity> & visible, Arena & scratch)
+    {
+        // Test in Parallel into a Flag per Bounds Slot, then Compact in Order
+        auto & bounds = registry.pool<Bounds>();
+        auto & transforms = registry.pool<Transform>();
+        FrameVector<unsigned char> flags(bounds.size(), 0, ArenaAllocator<unsigned char>(scratch));
+        scheduler.parallel_for(bounds.size(), kGrain, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                Entity entity = bounds.entities()[i];
+                if (transforms.contains(entity) == false) continue;
+                auto const & m = transforms.get(entity).world;
+                auto const & sphere = bounds.data()[i];
+                glm::vec3 center = glm::vec3(m * glm::vec4(sphere.center, 1.0f));
+                float radius = sphere.radius * glm::max(glm::length(glm::vec3(m[0])),
+                                               glm::max(glm::length(glm::vec3(m[1])), glm::length(glm::vec3(m[2]))));
+                flags[i] = frustum.visible(center, radius);
+            }
+        });
+
+        visible.clear();
+        for (std::size_t i = 0; i < flags.size(); i++)
+            if (flags[i]) visible.push_back(bounds.entities()[i]);
+    }
+};
@@ -0,0 +1,232 @@
+#pragma once
+
+// Local Headers
+#include "arena.hpp"
+#include "drawlist.hpp"
+#include "frustum.hpp"
+#include "jobs.hpp"
+
+// System Headers
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Forward Declarations
+class btRigidBody;
+
+// Define Namespace
+namespace Mirage
+{
+    // Index in the Low 24 Bits and a Version in the High 8, so Handles to
+    // Destroyed Entities Stop Matching Once their Index is Recycled
+    typedef std::uint32_t Entity;
+    static const Entity kNullEntity = ~Entity(0);
+
+    // Components Used by the Built-in Systems; Rotations are (x, y, z, w)
+    struct Transform {
+        glm::vec3 position;
+        glm::vec4 rotation;
+        glm::vec3 scale;
+        glm::mat4 world;
+        bool dirty;
+    };
+
+    struct Bounds {
+        glm::vec3 center;
+        float radius;
+    };
+
+    struct Body {
+        btRigidBody * body;
+        glm::vec3 position;
+        glm::vec4 rotation;
+        bool moved;
+    };
+
+    // Sparse Set: a Dense Array of Entities Packed Without Holes, and a Sparse
+    // Array Mapping Entity Indices to their Slot in It. Pools Keep Components
+    // in the Same Order as the Dense Array, so Iteration is a Linear Walk.
+    class Storage
+    {
+    public:
+
+        static const std::uint32_t kIndexBits = 24;
+        static const std::uint32_t kIndexMask = (1u << kIndexBits) - 1;
+
+        // Implement Default Destructor
+        virtual ~Storage() {}
+
+        // Public Member Functions
+        bool contains(Entity entity) const
+        {
+            std::uint32_t index = entity & kIndexMask;
+            return index < mSparse.size() && mSparse[index] < mDense.size() && mDense[mSparse[index]] == entity;
+        }
+        std::size_t   slot(Entity entity) const { return mSparse[entity & kIndexMask]; }
+        std::size_t   size() const { return mDense.size(); }
+        Entity const * entities() const { return mDense.data(); }
+        virtual void  remove(Entity entity) = 0;
+
+    protected:
+
+        // Protected Member Functions
+        void insert(Entity entity);
+        void erase(Entity entity);
+        void swap(std::size_t a, std::size_t b);
+
+        // Protected Member Containers
+        std::vector<std::uint32_t> mSparse;
+        std::vector<Entity> mDense;
+
+    };
+
+    template<typename T> class Pool : public Storage
+    {
+    public:
+
+        // Public Member Functions
+        T & insert(Entity entity, T const & value)
+        {
+            if (contains(entity)) return mComponents[slot(entity)] = value;
+            Storage::insert(entity);
+            mComponents.push_back(value);
+            return mComponents.back();
+        }
+        void remove(Entity entity) override
+        {
+            // Move the Last Component into the Hole, as erase() Does with its Entity
+            if (contains(entity) == false) return;
+            mComponents[slot(entity)] = std::move(mComponents.back());
+            mComponents.pop_back();
+            Storage::erase(entity);
+        }
+        T & get(Entity entity) { return mComponents[slot(entity)]; }
+        T * data() { return mComponents.data(); }
+        std::vector<T> const & components() const { return mComponents; }
+
+        // Reorder so Entities Shared with Another Pool Come First, in that
+        // Pool's Order; Joined Iteration Then Walks Both Arrays in Step
+        void align(Storage const & other)
+        {
+            std::size_t next = 0;
+            for (std::size_t i = 0; i < other.size(); i++)
+            {
+                Entity entity = other.entities()[i];
+                if (contains(entity) == false) continue;
+                std::size_t current = slot(entity);
+                if (current != next) { std::swap(mComponents[current], mComponents[next]); swap(current, next); }
+                next++;
+            }
+        }
+
+    private:
+
+        // Private Member Containers
+        std::vector<T> mComponents;
+
+    };
+
+    // Owns Entities and One Pool per Component Type. Joined Iteration Walks
+    // the First Pool Densely and Looks Entities Up in the Others, so List the
+    // Smallest Pool First. Don't Create, Destroy or Add Components While Iterating.
+    class Registry
+    {
+    public:
+
+        // Implement Default Constructor
+        Registry() = default;
+
+        // Public Member Functions
+        Entity create();
+        void   destroy(Entity entity);
+        bool   alive(Entity entity) const
+        {
+            std::uint32_t index = entity & Storage::kIndexMask;
+            return index < mEntities.size() && mEntities[index] == entity;
+        }
+        std::size_t size() const { return mEntities.size() - mFree.size(); }
+
+        // Component Access
+        template<typename T> Pool<T> & pool()
+        {
+            std::size_t id = family<T>();
+            if (id >= mPools.size()) mPools.resize(id + 1);
+            if (!mPools[id]) mPools[id].reset(new Pool<T>());
+            return static_cast<Pool<T> &>(* mPools[id]);
+        }
+        template<typename T> T & assign(Entity entity, T const & value = T()) { return pool<T>().insert(entity, value); }
+        template<typename T> void remove(Entity entity) { pool<T>().remove(entity); }
+        template<typename T> bool has(Entity entity) { return pool<T>().contains(entity); }
+        template<typename T> T &  get(Entity entity) { return pool<T>().get(entity); }
+        template<typename T, typename U> void align() { pool<U>().align(pool<T>()); }
+
+        // Call f(entity, t) for Every Entity with a T
+        template<typename T, typename F> void each(F const & f)
+        {
+            auto & ts = pool<T>();
+            for (std::size_t i = 0; i < ts.size(); i++) f(ts.entities()[i], ts.data()[i]);
+        }
+
+        // Call f(entity, t, u) for Every Entity with Both a T and a U
+        template<typename T, typename U, typename F> void each(F const & f)
+        {
+            auto & ts = pool<T>(); auto & us = pool<U>();
+            for (std::size_t i = 0; i < ts.size(); i++)
+            {
+                Entity entity = ts.entities()[i];
+                if (us.contains(entity)) f(entity, ts.data()[i], us.get(entity));
+            }
+        }
+
+        // Parallel Versions; f May Only Touch the Components it is Given
+        template<typename T, typename F> void each(Scheduler & scheduler, std::size_t grain, F const & f)
+        {
+            auto & ts = pool<T>();
+            scheduler.parallel_for(ts.size(), grain, [&ts, &f](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) f(ts.entities()[i], ts.data()[i]);
+            });
+        }
+
+        template<typename T, typename U, typename F> void each(Scheduler & scheduler, std::size_t grain, F const & f)
+        {
+            auto & ts = pool<T>(); auto & us = pool<U>();
+            scheduler.parallel_for(ts.size(), grain, [&ts, &us, &f](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    Entity entity = ts.entities()[i];
+                    if (us.contains(entity)) f(entity, ts.data()[i], us.get(entity));
+                }
+            });
+        }
+
+    private:
+
+        // Disable Copying and Assignment
+        Registry(Registry const &) = delete;
+        Registry & operator=(Registry const &) = delete;
+
+        // Sequential Component Type Identifiers
+        static std::size_t next();
+        template<typename T> static std::size_t family() { static std::size_t id = next(); return id; }
+
+        // Private Member Containers
+        std::vector<std::unique_ptr<Storage>> mPools;
+        std::vector<Entity> mEntities;
+        std::vector<std::uint32_t> mFree;
+
+    };
+
+    // Built-in Systems. sync() Copies Moved Rigid Bodies into their Transforms,
+    // place() Rebuilds Dirty World Matrices and Hands them to Renderables (so
+    // pool<Renderable>().components() Can Go Straight to DrawList::record),
+    // and cull() Collects Entities Whose World-Space Bounds are Visible,
+    // Keeping its Per-Object Scratch in the Frame Arena.
+    void sync(Registry & registry);
+    void place(Registry & registry, Scheduler & scheduler);
+    void cull(Registry & registry, Scheduler & scheduler, Frustum const & frustum,
+              std::vector<Entity> & visible, Arena & scratch);
+};
@@ -0,0 +1,147 @@
+// Local Headers
+#include "arena.hpp"
+#include "entity.hpp"
+#include "transform.hpp"
+
+// System Headers
+#include <glm/gtc/matrix_transform.hpp>
+
+// Standard Headers
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Compares Mirage::Registry Against a Tree of Heap-Allocated Objects (How
+// Mirage::Mesh Holds its Submeshes) Running the Same Physics Sync, Place and
+// Cull Work over 10k to 1M Entities, a Quarter of Which Have a Moving Body
+typedef std::chrono::high_resolution_clock Clock;
+
+static double elapsed(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// Pointer-Chasing Baseline
+struct Object {
+    Mirage::Transform transform;
+    Mirage::Bounds bounds;
+    Mirage::Renderable renderable;
+    std::unique_ptr<Mirage::Body> body;
+    std::vector<std::unique_ptr<Object>> children;
+};
+
+static void sync(Object & object)
+{
+    for (auto &i : object.children) sync(* i);
+    if (!object.body || object.body->moved == false) return;
+    object.transform.position = object.body->position;
+    object.transform.rotation = object.body->rotation;
+    object.transform.dirty = true;
+    object.body->moved = false;
+}
+
+static void place(Object & object)
+{
+    for (auto &i : object.children) place(* i);
+    if (object.transform.dirty == false) return;
+    auto & t = object.transform;
+    t.world = Mirage::Transforms::compose(t.position, t.rotation, t.scale);
+    t.dirty = false;
+    object.renderable.model = t.world;
+}
+
+static void cull(Object const & object, Mirage::Frustum const & frustum, std::vector<Object const *> & visible)
+{
+    for (auto &i : object.children) cull(* i, frustum, visible);
+    if (object.bounds.radius <= 0.0f) return;
+    auto const & m = object.transform.world;
+    glm::vec3 center = glm::vec3(m * glm::vec4(object.bounds.center, 1.0f));
+    if (frustum.visible(center, object.bounds.radius * glm::length(glm::vec3(m[0]))))
+        visible.push_back(& object);
+}
+
+// Median of a Few Frames, Resetting Body State Outside the Timed Region
+template<typename Reset, typename Run> static double measure(Reset const & reset, Run const & run)
+{
+    const int frames = 9;
+    std::vector<double> samples;
+    for (int i = 0; i < frames; i++)
+    {
+        reset();
+        auto start = Clock::now();
+        run();
+        samples.push_back(elapsed(start));
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[frames / 2];
+}
+
+int main(int argc, char * argv[])
+{
+    std::size_t largest = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    Mirage::Scheduler scheduler;
+    Mirage::Frustum frustum(glm::perspective(glm::radians(60.0f), 4.0f / 3.0f, 0.1f, 1000.0f) *
+                            glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+    fprintf(stdout, "threads: %u\n", scheduler.size());
+    fprintf(stdout, "\n%-10s %-6s %14s %14s %10s\n", "entities", "system", "objects (us)", "registry (us)", "speedup");
+
+    for (std::size_t count = 10000; count <= largest; count *= 10)
+    {
+        // Same Random Scene for Both; Objects are Allocated then Visited in Shuffled Order
+        std::mt19937 random(count);
+        std::uniform_real_distribution<float> spread(-500.0f, 500.0f);
+        Mirage::Registry registry;
+        Object root = {};
+        std::vector<std::unique_ptr<Object>> objects;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            glm::vec3 position(spread(random), spread(random), spread(random));
+            Mirage::Transform transform = { position, glm::vec4(0, 0, 0, 1), glm::vec3(1.0f), glm::mat4(1.0f), true };
+            Mirage::Bounds bounds = { glm::vec3(0.0f), 1.0f };
+            Mirage::Renderable renderable = {};
+
+            Mirage::Entity entity = registry.create();
+            registry.assign(entity, transform);
+            registry.assign(entity, bounds);
+            registry.assign(entity, renderable);
+            objects.push_back(std::unique_ptr<Object>(new Object { transform, bounds, renderable, nullptr, {} }));
+            if (i % 4) continue;
+
+            Mirage::Body body = { nullptr, position, glm::vec4(0, 0, 0, 1), true };
+            registry.assign(entity, body);
+            objects.back()->body.reset(new Mirage::Body(body));
+        }
+        std::shuffle(objects.begin(), objects.end(), random);
+        root.children = std::move(objects);
+        registry.align<Mirage::Transform, Mirage::Renderable>();
+
+        // Every Body Moves Each Frame, so a Quarter of the Transforms Go Dirty
+        auto moveObjects = [&root] { for (auto &i : root.children) if (i->body) i->body->moved = true; };
+        auto moveEntities = [&registry] { registry.each<Mirage::Body>([](Mirage::Entity, Mirage::Body & body) { body.moved = true; }); };
+        std::vector<Object const *> visibleObjects;
+        std::vector<Mirage::Entity> visibleEntities;
+        Mirage::Arena scratch(count);
+
+        double rows[3][2] = {
+            { measure(moveObjects, [&root] { sync(root); }),
+              measure(moveEntities, [&registry] { Mirage::sync(registry); }) },
+            { measure([&] { moveObjects(); sync(root); }, [&root] { place(root); }),
+              measure([&] { moveEntities(); Mirage::sync(registry); }, [&] { Mirage::place(registry, scheduler); }) },
+            { measure([] {}, [&] { visibleObjects.clear(); cull(root, frustum, visibleObjects); }),
+              measure([&] { scratch.reset(); }, [&] { Mirage::cull(registry, scheduler, frustum, visibleEntities, scratch); }) },
+        };
+
+        char const * names[] = { "sync", "place", "cull" };
+        for (int i = 0; i < 3; i++)
+            fprintf(stdout, "%-10zu %-6s %14.0f %14.0f %9.1fx\n", count, names[i],
+                    rows[i][0], rows[i][1], rows[i][0] / rows[i][1]);
+        if (visibleObjects.size() != visibleEntities.size())
+            fprintf(stderr, "Visible Counts Differ: %zu vs %zu\n", visibleObjects.size(), visibleEntities.size());
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// System Headers
+#include <glm/glm.hpp>
+
+// Define Namespace
+namespace Mirage
+{
+    class Frustum
+    {
+    public:
+
+        // Extract Normalized Planes (Left, Right, Bottom, Top, Near, Far) from a
+        // Combined Matrix; Pass projection * view * model to Cull in Model Space
+        explicit Frustum(glm::mat4 const & m)
+        {
+            for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 2; j++)
+            {
+                float sign = j ? -1.0f : 1.0f;
+                glm::vec4 & p = mPlanes[i * 2 + j];
+                for (int k = 0; k < 4; k++) p[k] = m[k][3] + sign * m[k][i];
+                p = p / glm::length(glm::vec3(p));
+            }
+        }
+
+        // Public Member Functions
+        glm::vec4 const & plane(int i) const { return mPlanes[i]; }
+        bool visible(glm::vec3 const & center, float radius) const
+        {
+            for (auto &p : mPlanes)
+                if (glm::dot(glm::vec3(p), center) + p.w < -radius) return false;
+            return true;
+        }
+
+    private:
+
+        // Private Member Containers
+        glm::vec4 mPlanes[6];
+
+    };
+};
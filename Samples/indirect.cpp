@@ -0,0 +1,195 @@
+// Local Headers
+#include "indirect.hpp"
+#include "frustum.hpp"
+
+// Standard Headers
+#include <cstddef>
+#include <cstdio>
+
+// Define Namespace
+namespace Mirage
+{
+    Indirect::Indirect()
+    {
+        // Compile the Culling Pass
+        mCull.attach("cull.comp").link();
+
+        // Generate Buffers; Geometry is Uploaded Lazily Once Registered
+        glGenVertexArrays(1, & mVertexArray);
+        glGenBuffers(1, & mVertexBuffer);
+        glGenBuffers(1, & mElementBuffer);
+        glGenBuffers(1, & mIdentityBuffer);
+        glGenBuffers(1, & mGeometryBuffer);
+        glGenBuffers(1, & mObjectBuffer);
+        glGenBuffers(1, & mCommandBuffer);
+
+        // Set Shader Attributes
+        glBindVertexArray(mVertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mElementBuffer);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLvoid *) offsetof(Vertex, position));
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLvoid *) offsetof(Vertex, normal));
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLvoid *) offsetof(Vertex, uv));
+        glEnableVertexAttribArray(0); // Vertex Positions
+        glEnableVertexAttribArray(1); // Vertex Normals
+        glEnableVertexAttribArray(2); // Vertex UVs
+
+        // Each Command's baseInstance Selects its Object Through this Attribute
+        glBindBuffer(GL_ARRAY_BUFFER, mIdentityBuffer);
+        glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(GLuint), nullptr);
+        glVertexAttribDivisor(3, 1);
+        glEnableVertexAttribArray(3); // Object IDs
+        glBindVertexArray(0);
+    }
+
+    Indirect::~Indirect()
+    {
+        GLuint buffers[] = { mVertexBuffer, mElementBuffer, mIdentityBuffer,
+                             mGeometryBuffer, mObjectBuffer, mCommandBuffer };
+        glDeleteBuffers(6, buffers);
+        glDeleteVertexArrays(1, & mVertexArray);
+    }
+
+    GLuint Indirect::add(std::vector<Vertex> const & vertices,
+                         std::vector<GLuint> const & indices,
+                         std::vector<Lod> const & lods)
+    {
+        // Empty Geometry Keeps its Index but Draws Nothing
+        Geometry geometry = { glm::vec4(0.0f), GLint(mVertices.size()), 0, {{ 0 }} };
+        if (vertices.empty() || indices.empty())
+        {
+            fprintf(stderr, "Empty Geometry: %lu Vertices, %lu Indices\n",
+                    static_cast<unsigned long>(vertices.size()), static_cast<unsigned long>(indices.size()));
+            geometry.levels = 1;
+            mGeometries.push_back(geometry);
+            mGeometryDirty = true;
+            return mGeometries.size() - 1;
+        }
+
+        // Rebase Every Level Onto the Shared Index Buffer
+        std::vector<Lod> levels(lods);
+        if (levels.empty()) levels.push_back(Lod { 0, GLuint(indices.size()), 0.0f });
+        for (auto &i : levels)
+        {
+            if (geometry.levels == kLodLevels) break;
+            geometry.lods[geometry.levels][0] = mIndices.size() + i.first;
+            geometry.lods[geometry.levels][1] = i.count;
+            geometry.levels++;
+        }
+
+        // Bounding Sphere Centered on the Box
+        glm::vec3 lower = vertices.front().position, upper = lower;
+        for (auto &i : vertices) lower = glm::min(lower, i.position), upper = glm::max(upper, i.position);
+        glm::vec3 center = (lower + upper) * 0.5f;
+        float radius = 0.0f;
+        for (auto &i : vertices) radius = glm::max(radius, glm::distance(center, i.position));
+        geometry.sphere = glm::vec4(center, radius);
+
+        mVertices.insert(mVertices.end(), vertices.begin(), vertices.end());
+        mIndices.insert(mIndices.end(), indices.begin(), indices.end());
+        mGeometries.push_back(geometry);
+        mGeometryDirty = true;
+        return mGeometries.size() - 1;
+    }
+
+    GLuint Indirect::add(GLuint geometry, glm::mat4 const & model)
+    {
+        mObjects.push_back(Object { model, geometry, 0, { 0, 0 } });
+        mObjectsDirty = true;
+        return mObjects.size() - 1;
+    }
+
+    void Indirect::move(GLuint object, glm::mat4 const & model)
+    {
+        mObjects[object].model = model;
+        mMoved.push_back(object);
+        mObjectsDirty = true;
+    }
+
+    void Indirect::upload()
+    {
+        if (mGeometryDirty)
+        {
+            // Copy Shared Vertex, Index and Geometry Data
+            glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+            glBufferData(GL_ARRAY_BUFFER, mVertices.size() * sizeof(Vertex), mVertices.data(), GL_STATIC_DRAW);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mElementBuffer);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndices.size() * sizeof(GLuint), mIndices.data(), GL_STATIC_DRAW);
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, mGeometryBuffer);
+            glBufferData(GL_SHADER_STORAGE_BUFFER, mGeometries.size() * sizeof(Geometry), mGeometries.data(), GL_STATIC_DRAW);
+            mGeometryDirty = false;
+        }
+
+        if (mObjectsDirty)
+        {
+            // Object Count Changes Resize the ID and Command Buffers Too;
+            // cull.comp Takes the Object Count from the Buffer Length
+            GLint size; glBindBuffer(GL_SHADER_STORAGE_BUFFER, mObjectBuffer);
+            glGetBufferParameteriv(GL_SHADER_STORAGE_BUFFER, GL_BUFFER_SIZE, & size);
+            if (size != GLint(mObjects.size() * sizeof(Object)))
+            {
+                std::vector<GLuint> identity(mObjects.size());
+                for (GLuint i = 0; i < identity.size(); i++) identity[i] = i;
+                glBindBuffer(GL_ARRAY_BUFFER, mIdentityBuffer);
+                glBufferData(GL_ARRAY_BUFFER, identity.size() * sizeof(GLuint), identity.data(), GL_STATIC_DRAW);
+
+                // Zeroed Commands Draw Nothing Until the First cull()
+                std::vector<GLuint> commands(mObjects.size() * 5, 0);
+                glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandBuffer);
+                glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(GLuint), commands.data(), GL_DYNAMIC_DRAW);
+
+                // cull.comp Writes Levels Back on the GPU, so Carry the Old
+                // Objects Over Rather than Reset them from the CPU Mirror
+                GLuint buffer; glGenBuffers(1, & buffer);
+                glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+                glBufferData(GL_COPY_WRITE_BUFFER, mObjects.size() * sizeof(Object), mObjects.data(), GL_DYNAMIC_DRAW);
+                if (size > 0) glCopyBufferSubData(GL_SHADER_STORAGE_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, size);
+                glDeleteBuffers(1, & mObjectBuffer);
+                mObjectBuffer = buffer;
+                glBindBuffer(GL_SHADER_STORAGE_BUFFER, mObjectBuffer);
+            }
+
+            // Only Models Come from the CPU; Each Object's Level Stays as Culled
+            for (auto i : mMoved)
+                glBufferSubData(GL_SHADER_STORAGE_BUFFER, i * sizeof(Object) + offsetof(Object, model),
+                                sizeof(glm::mat4), & mObjects[i].model);
+            mMoved.clear();
+            mObjectsDirty = false;
+        }
+    }
+
+    void Indirect::cull(glm::mat4 const & view_projection, glm::vec3 const & eye, float scale)
+    {
+        upload();
+        if (mObjects.empty()) return;
+
+        // Bind Culling Inputs
+        Frustum frustum(view_projection);
+        GLuint program = mCull.activate().get();
+        glUniform4fv(glGetUniformLocation(program, "planes"), 6, & frustum.plane(0).x);
+        glUniform3f(glGetUniformLocation(program, "eye"), eye.x, eye.y, eye.z);
+        glUniform1f(glGetUniformLocation(program, "scale"), scale);
+        glUniform1fv(glGetUniformLocation(program, "sizes"), kLodLevels, kLodSizes);
+        glUniform1f(glGetUniformLocation(program, "hysteresis"), kLodHysteresis);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, mObjectBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, mGeometryBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, mCommandBuffer);
+
+        // One Invocation per Object Writes One Draw Command
+        glDispatchCompute((mObjects.size() + 63) / 64, 1, 1);
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+    }
+
+    void Indirect::draw()
+    {
+        upload();
+        if (mObjects.empty()) return;
+
+        // Culled Objects Have Zero Instances, so the GPU Skips Them
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, mObjectBuffer);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandBuffer);
+        glBindVertexArray(mVertexArray);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, mObjects.size(), 0);
+        glBindVertexArray(0);
+    }
+};
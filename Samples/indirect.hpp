@@ -0,0 +1,85 @@
+#pragma once
+
+// Local Headers
+#include "mesh.hpp"
+#include "shader.hpp"
+
+// System Headers
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // GPU-Driven Renderer: Geometry Shares One Vertex and Index Buffer, a
+    // Compute Pass Culls Objects and Picks LODs, and a Single Indirect Call
+    // Draws Everything; CPU Cost No Longer Depends on the Object Count.
+    // Needs OpenGL 4.3, Which Mesa's llvmpipe Provides.
+    class Indirect
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor
+         Indirect();
+        ~Indirect();
+
+        // Register Geometry (with Optional LODs from ImportGenerateLods) and
+        // Instances of it; Both Return Indices Usable with move() and draw()
+        GLuint add(std::vector<Vertex> const & vertices,
+                   std::vector<GLuint> const & indices,
+                   std::vector<Lod> const & lods = {});
+        GLuint add(GLuint geometry, glm::mat4 const & model);
+        void   move(GLuint object, glm::mat4 const & model);
+
+        // Public Member Functions
+        void cull(glm::mat4 const & view_projection, glm::vec3 const & eye, float scale);
+        void draw();
+
+    private:
+
+        // Disable Copying and Assignment
+        Indirect(Indirect const &) = delete;
+        Indirect & operator=(Indirect const &) = delete;
+
+        // Mirrors of the std430 Structs in cull.comp
+        struct Geometry {
+            glm::vec4 sphere;
+            GLint  base;
+            GLuint levels;
+            GLuint lods[kLodLevels][2];
+        };
+
+        struct Object {
+            glm::mat4 model;
+            GLuint geometry;
+            GLuint level;
+            GLuint padding[2];
+        };
+
+        // Private Member Functions
+        void upload();
+
+        // Private Member Containers
+        std::vector<Vertex>   mVertices;
+        std::vector<GLuint>   mIndices;
+        std::vector<Geometry> mGeometries;
+        std::vector<Object>   mObjects;
+        std::vector<GLuint>   mMoved;
+
+        // Private Member Variables
+        Shader mCull;
+        bool   mGeometryDirty = false;
+        bool   mObjectsDirty  = false;
+        GLuint mVertexArray;
+        GLuint mVertexBuffer;
+        GLuint mElementBuffer;
+        GLuint mIdentityBuffer;
+        GLuint mGeometryBuffer;
+        GLuint mObjectBuffer;
+        GLuint mCommandBuffer;
+
+    };
+};
@@ -0,0 +1,222 @@
+// Local Headers
+#include "jobs.hpp"
+
+// Standard Headers
+#include <chrono>
+
+// Define Namespace
+namespace Mirage
+{
+    // Jobs are Recycled from a Per-Thread Ring; a Slot is Only Reused Once its
+    // Job Has Finished, so Long-Lived Jobs (Like a parallel_for Root) are Skipped
+    static const unsigned int kJobs = 4096;
+    static const unsigned int kSpins = 64;
+    static const unsigned int kNone = ~0u;
+    static thread_local std::unique_ptr<Job[]> tJobs;
+    static thread_local unsigned int tNext = 0;
+    static thread_local unsigned int tIndex = kNone;
+
+    bool Deque::push(Job * job)
+    {
+        long bottom = mBottom.load(std::memory_order_relaxed);
+        long top = mTop.load(std::memory_order_acquire);
+        if (bottom - top >= kCapacity) return false;
+        mJobs[bottom & (kCapacity - 1)].store(job, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        mBottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    Job * Deque::pop()
+    {
+        long bottom = mBottom.load(std::memory_order_relaxed) - 1;
+        mBottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long top = mTop.load(std::memory_order_relaxed);
+
+        // Empty; Restore the Bottom Index
+        if (top > bottom)
+        {
+            mBottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        // Racing Thieves for the Last Job; Whoever Advances the Top Wins
+        Job * job = mJobs[bottom & (kCapacity - 1)].load(std::memory_order_relaxed);
+        if (top == bottom)
+        {
+            if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                            std::memory_order_relaxed)) job = nullptr;
+            mBottom.store(bottom + 1, std::memory_order_relaxed);
+        }   return job;
+    }
+
+    Job * Deque::steal()
+    {
+        long top = mTop.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long bottom = mBottom.load(std::memory_order_acquire);
+        if (top >= bottom) return nullptr;
+
+        Job * job = mJobs[top & (kCapacity - 1)].load(std::memory_order_relaxed);
+        if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                        std::memory_order_relaxed)) return nullptr;
+        return job;
+    }
+
+    Scheduler::Scheduler(unsigned int workers) : mRunning(true), mSleeping(0)
+    {
+        if (workers == 0) workers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+
+        // The Calling Thread Owns Deque Zero
+        for (unsigned int i = 0; i <= workers; i++) mDeques.emplace_back(new Deque());
+        tIndex = 0;
+        for (unsigned int i = 1; i <= workers; i++)
+            mThreads.emplace_back([this, i] { work(i); });
+    }
+
+    Scheduler::~Scheduler()
+    {
+        mRunning = false;
+        { std::lock_guard<std::mutex> lock(mMutex); mWake.notify_all(); }
+        for (auto &i : mThreads) i.join();
+        tIndex = kNone;
+    }
+
+    Job * Scheduler::allocate(Job * parent)
+    {
+        if (!tJobs)
+        {
+            tJobs.reset(new Job[kJobs]);
+            for (unsigned int i = 0; i < kJobs; i++) tJobs[i].unfinished.store(0, std::memory_order_relaxed);
+        }
+
+        // Every Slot Still in Flight; Help Out Until One of them Finishes
+        Job * job = nullptr;
+        for (;;)
+        {
+            for (unsigned int i = 0; i < kJobs && !job; i++)
+            {
+                Job * slot = & tJobs[tNext++ & (kJobs - 1)];
+                if (slot->unfinished.load(std::memory_order_acquire) == 0) job = slot;
+            }
+
+            if (job) break;
+            Job * other = next(tIndex);
+            if (other) execute(other);
+            else std::this_thread::yield();
+        }
+
+        job->function = nullptr;
+        job->parent = parent;
+        job->unfinished.store(1, std::memory_order_relaxed);
+        if (parent) parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    void Scheduler::run(Job * job)
+    {
+        // Threads Outside the Pool Hand Jobs Over Through a Locked Queue
+        if (tIndex == kNone)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mInjected.push_back(job);
+        }
+
+        // A Full Deque Just Means Running the Job Right Here
+        else if (!mDeques[tIndex]->push(job)) execute(job);
+
+        if (mSleeping.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mWake.notify_one();
+        }
+    }
+
+    void Scheduler::main(Job * job)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mMain.push_back(job);
+    }
+
+    void Scheduler::pump()
+    {
+        for (;;)
+        {
+            Job * job = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mMain.empty()) return;
+                job = mMain.front();
+                mMain.pop_front();
+            }   execute(job);
+        }
+    }
+
+    void Scheduler::wait(Job * job)
+    {
+        // Keep Busy with Other Work Rather than Blocking
+        while (job->unfinished.load(std::memory_order_acquire) > 0)
+        {
+            if (tIndex == 0) pump();
+            Job * other = next(tIndex);
+            if (other) execute(other);
+            else std::this_thread::yield();
+        }
+    }
+
+    Job * Scheduler::next(unsigned int index)
+    {
+        // Prefer Our Own Newest Work, Which is Likely Still in Cache
+        Job * job = nullptr;
+        if (index != kNone && (job = mDeques[index]->pop())) return job;
+
+        // Then Steal the Oldest Work from Everyone Else
+        unsigned int count = mDeques.size();
+        unsigned int start = (index == kNone) ? 0 : index + 1;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            unsigned int victim = (start + i) % count;
+            if (victim != index && (job = mDeques[victim]->steal())) return job;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mInjected.empty()) return nullptr;
+        job = mInjected.front();
+        mInjected.pop_front();
+        return job;
+    }
+
+    void Scheduler::execute(Job * job)
+    {
+        if (job->function) job->function(* job);
+        finish(job);
+    }
+
+    void Scheduler::finish(Job * job)
+    {
+        // The Last Child to Finish Completes its Parent; Read the Parent First,
+        // as a Waiter May Recycle the Job as Soon as the Count Reaches Zero
+        Job * parent = job->parent;
+        if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1 && parent)
+            finish(parent);
+    }
+
+    void Scheduler::work(unsigned int index)
+    {
+        tIndex = index;
+        unsigned int idle = 0;
+        while (mRunning)
+        {
+            Job * job = next(index);
+            if (job) { execute(job); idle = 0; continue; }
+            if (++idle < kSpins) { std::this_thread::yield(); continue; }
+
+            // Sleep Until Woken by run(); the Timeout Covers Missed Wakeups
+            std::unique_lock<std::mutex> lock(mMutex);
+            mSleeping++;
+            mWake.wait_for(lock, std::chrono::milliseconds(1));
+            mSleeping--;
+        }   tIndex = kNone;
+    }
+};
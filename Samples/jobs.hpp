@@ -0,0 +1,143 @@
+#pragma once
+
+// Standard Headers
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Unit of Work; Callables are Stored Inline so Creating a Job Never Allocates
+    struct Job {
+        void (*function)(Job &);
+        Job * parent;
+        std::atomic<int> unfinished;
+        alignas(8) unsigned char data[48];
+    };
+
+    // Chase-Lev Work-Stealing Deque: the Owner Pushes and Pops at the Bottom,
+    // Other Threads Steal from the Top
+    class Deque
+    {
+    public:
+
+        // Capacity Must be a Power of Two
+        static const long kCapacity = 4096;
+
+        // Implement Default Constructor
+        Deque() : mTop(0), mBottom(0), mJobs(new std::atomic<Job *>[kCapacity]) {}
+
+        // Public Member Functions
+        bool  push(Job * job);
+        Job * pop();
+        Job * steal();
+
+    private:
+
+        // Disable Copying and Assignment
+        Deque(Deque const &) = delete;
+        Deque & operator=(Deque const &) = delete;
+
+        // Private Member Variables; Padded so Owner and Thieves Don't Share a Line
+        std::atomic<long> mTop;
+        char mPadding[64];
+        std::atomic<long> mBottom;
+        std::unique_ptr<std::atomic<Job *>[]> mJobs;
+
+    };
+
+    // Work-Stealing Task Scheduler. The Thread that Creates it Becomes Thread
+    // Zero (the Main Thread), which Helps Out While Waiting and is the Only
+    // Thread that Runs Jobs Submitted Through main(), Such as GL Calls.
+    class Scheduler
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor; Zero Workers Means One
+        // Fewer than the Number of Hardware Threads
+        explicit Scheduler(unsigned int workers = 0);
+        ~Scheduler();
+
+        // Create a Job Running `function`; Parents Complete After All Children
+        template<typename F> Job * create(F const & function, Job * parent = nullptr)
+        {
+            static_assert(sizeof(F) <= sizeof(Job::data), "Job Capture Too Large");
+            Job * job = allocate(parent);
+            new (job->data) F(function);
+            job->function = [](Job & self) {
+                F * f = reinterpret_cast<F *>(self.data);
+                (* f)();
+                f->~F();
+            };  return job;
+        }
+
+        // Create an Empty Job, Useful as a Parent to Wait On
+        Job * create(Job * parent = nullptr) { return allocate(parent); }
+
+        // Public Member Functions
+        void run(Job * job);
+        void main(Job * job);
+        void wait(Job * job);
+        void pump();
+        unsigned int size() const { return mDeques.size(); }
+
+        // Split [0, count) into Ranges of at Most `grain` and Call f(begin, end)
+        // on Each in Parallel, Returning Once Every Range has Finished
+        template<typename F> void parallel_for(std::size_t count, std::size_t grain, F const & f)
+        {
+            if (count == 0) return;
+            Job * root = create();
+            split(& f, 0, count, grain ? grain : 1, root);
+            finish(root);
+            wait(root);
+        }
+
+    private:
+
+        // Disable Copying and Assignment
+        Scheduler(Scheduler const &) = delete;
+        Scheduler & operator=(Scheduler const &) = delete;
+
+        // Hand the Upper Half to Thieves and Keep Halving the Lower Half, so
+        // Work Spreads Out in Logarithmic Steps Instead of One Job per Range
+        template<typename F> void split(F const * f, std::size_t begin, std::size_t end,
+                                        std::size_t grain, Job * root)
+        {
+            while (end - begin > grain)
+            {
+                std::size_t middle = begin + (end - begin) / 2;
+                run(create([this, f, middle, end, grain, root] {
+                    split(f, middle, end, grain, root);
+                }, root));
+                end = middle;
+            }   (* f)(begin, end);
+        }
+
+        // Private Member Functions
+        Job * allocate(Job * parent);
+        Job * next(unsigned int index);
+        void  execute(Job * job);
+        void  finish(Job * job);
+        void  work(unsigned int index);
+
+        // Private Member Containers
+        std::vector<std::unique_ptr<Deque>> mDeques;
+        std::vector<std::thread> mThreads;
+        std::deque<Job *> mInjected;
+        std::deque<Job *> mMain;
+
+        // Private Member Variables
+        std::mutex mMutex;
+        std::condition_variable mWake;
+        std::atomic<bool> mRunning;
+        std::atomic<int>  mSleeping;
+
+    };
+};
@@ -0,0 +1,104 @@
+// Local Headers
+#include "jobs.hpp"
+
+// Standard Headers
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <thread>
+#include <vector>
+
+// Compares Mirage::Scheduler Against std::async on Throughput (Many Small
+// Tasks) and Latency (Time from Submitting One Task Until a Worker Starts it)
+typedef std::chrono::high_resolution_clock Clock;
+
+static double elapsed(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// Roughly a Microsecond of Arithmetic per Item
+static float work(std::size_t i)
+{
+    float x = float(i);
+    for (int j = 0; j < 200; j++) x = std::sqrt(x * x + 1.0f);
+    return x;
+}
+
+int main(int argc, char * argv[])
+{
+    std::size_t tasks = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    std::size_t grain = 64;
+    Mirage::Scheduler scheduler;
+    std::vector<float> results(tasks);
+    fprintf(stdout, "threads: %u, tasks: %zu, grain: %zu\n", scheduler.size(), tasks, grain);
+
+    // Throughput: Scheduler
+    auto start = Clock::now();
+    scheduler.parallel_for(tasks, grain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) results[i] = work(i);
+    });
+    double jobs = elapsed(start);
+
+    // Throughput: One std::async per Grain-Sized Chunk
+    start = Clock::now();
+    std::vector<std::future<void>> futures;
+    for (std::size_t begin = 0; begin < tasks; begin += grain)
+    {
+        std::size_t end = std::min(tasks, begin + grain);
+        futures.push_back(std::async(std::launch::async, [&results, begin, end] {
+            for (std::size_t i = begin; i < end; i++) results[i] = work(i);
+        }));
+    }   for (auto &i : futures) i.wait();
+    double async = elapsed(start);
+
+    // Throughput: Serial Baseline
+    start = Clock::now();
+    for (std::size_t i = 0; i < tasks; i++) results[i] = work(i);
+    double serial = elapsed(start);
+
+    fprintf(stdout, "\n%-12s %12s %12s\n", "throughput", "total (us)", "Mitems/s");
+    fprintf(stdout, "%-12s %12.0f %12.2f\n", "serial",     serial, tasks / serial);
+    fprintf(stdout, "%-12s %12.0f %12.2f\n", "scheduler",  jobs,   tasks / jobs);
+    fprintf(stdout, "%-12s %12.0f %12.2f\n", "std::async", async,  tasks / async);
+
+    // Latency: Submit One Empty Task and Time Until a Worker Begins it. Waiting
+    // with wait() Would Pop the Job Right Back Off Our Own Deque, so Spin on a
+    // Flag Instead; Only a Worker Stealing it Can Start the Job
+    const int samples = 1000;
+    std::vector<double> schedulerLatency, asyncLatency;
+    for (int i = 0; i < samples; i++)
+    {
+        std::atomic<double> started(0.0);
+        std::atomic<bool> ran(false);
+        auto submitted = Clock::now();
+        Mirage::Job * job = scheduler.create([&started, &ran, submitted] {
+            started = elapsed(submitted);
+            ran = true;
+        });
+        scheduler.run(job);
+        while (!ran) std::this_thread::yield();
+        scheduler.wait(job);
+        schedulerLatency.push_back(started);
+
+        submitted = Clock::now();
+        std::async(std::launch::async, [&started, submitted] { started = elapsed(submitted); }).wait();
+        asyncLatency.push_back(started);
+    }
+
+    // Report Median and 99th Percentile
+    fprintf(stdout, "\n%-12s %12s %12s\n", "latency", "p50 (us)", "p99 (us)");
+    for (auto row : { std::make_pair("scheduler", & schedulerLatency),
+                      std::make_pair("std::async", & asyncLatency) })
+    {
+        auto & v = * row.second;
+        std::sort(v.begin(), v.end());
+        fprintf(stdout, "%-12s %12.2f %12.2f\n", row.first, v[v.size() / 2], v[v.size() * 99 / 100]);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,67 @@
+// Local Headers
+#include "jobs.hpp"
+
+// Standard Headers
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Checks that Mirage::Scheduler Runs Every Index of a parallel_for Exactly
+// Once, Including Ranges that Need Many More Jobs than a Thread's Job Ring
+// Holds, and Fan-Outs that Keep More Jobs in Flight than the Ring at Once
+static std::size_t check(std::vector<std::atomic<int>> const & hits, std::size_t count)
+{
+    std::size_t bad = 0;
+    for (std::size_t i = 0; i < count; i++) if (hits[i] != 1) bad++;
+    return bad;
+}
+
+int main(int argc, char * argv[])
+{
+    std::size_t largest = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::vector<std::atomic<int>> hits(largest);
+    std::size_t failures = 0;
+    fprintf(stdout, "%-8s %-10s %-6s %10s\n", "threads", "count", "grain", "wrong");
+
+    for (unsigned int workers : { 1u, 3u, 0u })
+    {
+        Mirage::Scheduler scheduler(workers);
+        for (std::size_t count : { std::size_t(1), std::size_t(4097), std::size_t(15839),
+                                   std::size_t(23758), largest })
+        for (std::size_t grain : { 1, 3, 4, 64 })
+        {
+            if (count > largest) continue;
+            for (std::size_t i = 0; i < count; i++) hits[i] = 0;
+            scheduler.parallel_for(count, grain, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) hits[i]++;
+            });
+
+            std::size_t bad = check(hits, count);
+            failures += bad;
+            if (bad) fprintf(stdout, "%-8u %-10zu %-6zu %10zu\n", scheduler.size(), count, grain, bad);
+        }
+
+        // Flat Fan-Out of Slow Jobs: they Queue Up Faster than they Run, so the
+        // Creating Thread Fills its Ring and Has to Help Out Before Creating More
+        std::size_t count = std::min<std::size_t>(largest, 20000);
+        for (std::size_t i = 0; i < count; i++) hits[i] = 0;
+        Mirage::Job * root = scheduler.create();
+        for (std::size_t i = 0; i < count; i++)
+            scheduler.run(scheduler.create([&hits, i] {
+                volatile float x = 1.0f;
+                for (int j = 0; j < 1000; j++) x = x * 0.5f + 1.0f;
+                hits[i]++;
+            }, root));
+        scheduler.run(root);
+        scheduler.wait(root);
+
+        std::size_t bad = check(hits, count);
+        failures += bad;
+        fprintf(stdout, "%-8u %-10zu %-6s %10zu\n", scheduler.size(), count, "fan", bad);
+    }
+
+    fprintf(stdout, "%s\n", failures ? "FAILED" : "passed");
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
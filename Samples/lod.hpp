@@ -0,0 +1,23 @@
+#pragma once
+
+// Standard Headers
+#include <limits>
+
+// Define Namespace
+namespace Mirage
+{
+    // Smallest Projected Radius (in NDC) at Which Each Level is Still Used,
+    // and the Margin a Switch Must Clear so Levels Don't Flicker at the Edge.
+    // Shared by Mesh::select, DrawList::record and cull.comp (as Uniforms).
+    static const unsigned int kLodLevels = 5;
+    static const float kLodSizes[kLodLevels] = { std::numeric_limits<float>::max(), 0.4f, 0.2f, 0.1f, 0.05f };
+    static const float kLodHysteresis = 0.15f;
+
+    // Step Across Thresholds from Last Frame's Level Only Once the Size Clears Them
+    inline unsigned int lod(unsigned int level, unsigned int levels, float size)
+    {
+        while (level + 1 < levels && size < kLodSizes[level + 1] * (1.0f - kLodHysteresis)) level++;
+        while (level > 0 && size > kLodSizes[level] * (1.0f + kLodHysteresis)) level--;
+        return level;
+    }
+};
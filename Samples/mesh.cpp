@@ -3,27 +3,104 @@
 
 // Local Headers
 #include "mesh.hpp"
+#include "package.hpp"
+#include "simplify.hpp"
 
 // System Headers
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+#include <glm/gtc/type_ptr.hpp>
 #include <stb_image.h>
 
+// Standard Headers
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
 // Define Namespace
 namespace Mirage
 {
-    Mesh::Mesh(std::string const & filename) : Mesh()
+    // Lets Assimp Read Models (and the Files they Reference) from a Package
+    class PackageStream : public Assimp::IOStream
+    {
+    public:
+        PackageStream(Span span, std::vector<unsigned char> && scratch)
+            : mSpan(span), mScratch(std::move(scratch)) {}
+        std::size_t Read(void * buffer, std::size_t size, std::size_t count) override
+        {
+            if (size == 0) return 0;
+            count = std::min(count, (mSpan.size - mPosition) / size);
+            std::memcpy(buffer, mSpan.data + mPosition, size * count);
+            mPosition += size * count;
+            return count;
+        }
+        std::size_t Write(void const *, std::size_t, std::size_t) override { return 0; }
+        aiReturn Seek(std::size_t offset, aiOrigin origin) override
+        {
+            std::size_t base = origin == aiOrigin_SET ? 0 : origin == aiOrigin_CUR ? mPosition : mSpan.size;
+            if (base + offset > mSpan.size) return aiReturn_FAILURE;
+            mPosition = base + offset;
+            return aiReturn_SUCCESS;
+        }
+        std::size_t Tell() const override { return mPosition; }
+        std::size_t FileSize() const override { return mSpan.size; }
+        void Flush() override {}
+    private:
+        Span mSpan;
+        std::vector<unsigned char> mScratch;
+        std::size_t mPosition = 0;
+    };
+
+    class PackageSystem : public Assimp::IOSystem
+    {
+    public:
+        explicit PackageSystem(Package const & package) : mPackage(package) {}
+        bool Exists(char const * filename) const override { return mPackage.find(filename) != nullptr; }
+        char getOsSeparator() const override { return '/'; }
+        Assimp::IOStream * Open(char const * filename, char const *) override
+        {
+            Span span; std::vector<unsigned char> scratch;
+            if (mPackage.read(filename, span, scratch) == false) return nullptr;
+            return new PackageStream(span, std::move(scratch));
+        }
+        void Close(Assimp::IOStream * stream) override { delete stream; }
+    private:
+        Package const & mPackage;
+    };
+
+    Mesh::Mesh(std::string const & filename, unsigned int flags) : Mesh()
     {
-        // Load a Model from File
+        mFlags = flags;
+
+        // Collect Textures into Shared Arrays Instead of One Object Each
+        if (flags & ImportPackTextures) mArrays.reset(new TextureArrays());
+
+        // Load a Model from the Mounted Package, or Else from File
         Assimp::Importer loader;
+        std::string path = PROJECT_SOURCE_DIR "/Mirage/Models/" + filename;
+        auto package = Package::mounted();
+        if (package && package->find(path)) loader.SetIOHandler(new PackageSystem(* package));
         aiScene const * scene = loader.ReadFile(
-            PROJECT_SOURCE_DIR "/Mirage/Models/" + filename,
+            path,
             aiProcessPreset_TargetRealtime_MaxQuality |
             aiProcess_OptimizeGraph                   |
             aiProcess_FlipUVs);
 
-        // Walk the Tree of Scene Nodes
+        // Skinned or Animated Models Keep their Node Hierarchy as a Skeleton
+        bool skinned = false;
+        for (unsigned int i = 0; scene && i < scene->mNumMeshes; i++) skinned |= scene->mMeshes[i]->HasBones();
+        if (scene && (skinned || scene->mNumAnimations)) mSkeleton.reset(new Skeleton(scene->mRootNode));
+
+        // Walk the Tree of Scene Nodes, Recording Where Each Places its Meshes
         auto index = filename.find_last_of("/");
+        mTransforms.reset(new Transforms());
         if (!scene) fprintf(stderr, "%s\n", loader.GetErrorString());
-        else parse(filename.substr(0, index), scene->mRootNode, scene);
+        else parse(filename.substr(0, index), scene->mRootNode, scene, -1);
+        if (mArrays) mArrays->upload();
+
+        // Resample Every Animation Against the Skeleton
+        for (unsigned int i = 0; mSkeleton && i < scene->mNumAnimations; i++)
+            mClips.emplace_back(scene->mAnimations[i], * mSkeleton);
     }
 
     Mesh::Mesh(std::vector<Vertex> const & vertices,
@@ -55,46 +132,189 @@ namespace Mirage
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLvoid *) offsetof(Vertex, position));
         glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLvoid *) offsetof(Vertex, normal));
         glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLvoid *) offsetof(Vertex, uv));
+        glVertexAttribIPointer(3, 4, GL_UNSIGNED_BYTE,     sizeof(Vertex), (GLvoid *) offsetof(Vertex, bones));
+        glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLvoid *) offsetof(Vertex, weights));
         glEnableVertexAttribArray(0); // Vertex Positions
         glEnableVertexAttribArray(1); // Vertex Normals
         glEnableVertexAttribArray(2); // Vertex UVs
+        glEnableVertexAttribArray(3); // Vertex Bone Indices
+        glEnableVertexAttribArray(4); // Vertex Bone Weights
+
+        // Depth-Only Passes Stream Just Positions, Packed, Sharing the Indices
+        std::vector<glm::vec3> positions;
+        positions.reserve(mVertices.size());
+        for (auto &i : mVertices) positions.push_back(i.position);
+        glGenVertexArrays(1, & mPositionArray);
+        glBindVertexArray(mPositionArray);
+        glGenBuffers(1, & mPositionBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mPositionBuffer);
+        glBufferData(GL_ARRAY_BUFFER,
+                     positions.size() * sizeof(glm::vec3),
+                   & positions.front(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mElementBuffer);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), nullptr);
+        glEnableVertexAttribArray(0); // Vertex Positions
 
         // Cleanup Buffers
         glBindVertexArray(0);
         glDeleteBuffers(1, & mVertexBuffer);
         glDeleteBuffers(1, & mElementBuffer);
+        glDeleteBuffers(1, & mPositionBuffer);
+    }
+
+    void Mesh::draw(GLuint shader, glm::mat4 const & model, glm::mat4 const & viewProjection)
+    {
+        if (mTransforms) mTransforms->update();
+        Pass pass = {{ 0 }, { 0, 0 }, & model, & viewProjection};
+        draw(shader, pass);
+        mStats = pass.stats;
     }
 
-    void Mesh::draw(GLuint shader)
+    void Mesh::select(glm::vec3 const & eye, float scale)
+    {
+        // Submeshes Placed by a Scene Node Measure Distance in their Own Space
+        if (mTransforms) mTransforms->update();
+        for (auto &i : mSubMeshes)
+            i->select(i->mNodes ? glm::vec3(glm::inverse(i->mNodes->world(i->mNode)) * glm::vec4(eye, 1.0f)) : eye, scale);
+        if (mLods.size() < 2) return;
+
+        // Projected Radius of the Bounding Sphere; Scale is projection[1][1]
+        float distance = glm::max(glm::distance(eye, mCenter), mRadius);
+        float size = mRadius * scale / distance;
+
+        mLevel = lod(mLevel, unsigned(mLods.size()), size);
+    }
+
+    void Mesh::cull(glm::mat4 const & transform, glm::vec3 const & eye,
+                    Occlusion const * occlusion)
+    {
+        if (mTransforms) mTransforms->update();
+        cull(Frustum(transform), transform, eye, occlusion);
+    }
+
+    void Mesh::cull(Frustum const & frustum, glm::mat4 const & transform,
+                    glm::vec3 const & eye, Occlusion const * occlusion)
+    {
+        for (auto &i : mSubMeshes)
+        {   // Submeshes Placed by a Scene Node Cull in their Own Space
+            if (i->mNodes == nullptr) { i->cull(frustum, transform, eye, occlusion); continue; }
+            glm::mat4 const & world = i->mNodes->world(i->mNode);
+            glm::mat4 placed = transform * world;
+            i->cull(Frustum(placed), placed, glm::vec3(glm::inverse(world) * glm::vec4(eye, 1.0f)), occlusion);
+        }
+        mCulled = mRadius > 0.0f && !frustum.visible(mCenter, mRadius);
+
+        // Boxes Hidden Behind Rasterized Occluders Skip Meshlet Culling Entirely
+        if (occlusion && !mCulled && mRadius > 0.0f)
+            mCulled = !occlusion->visible(mLower, mUpper, transform);
+        if (mMeshlets && !mCulled) mMeshlets->cull(frustum, eye);
+    }
+
+    void Mesh::occlude(Occlusion & occlusion, glm::mat4 const & transform) const
+    {
+        if (mTransforms) mTransforms->update();
+        for (auto &i : mSubMeshes)
+            i->occlude(occlusion, i->mNodes ? transform * i->mNodes->world(i->mNode) : transform);
+        if (mIndices.empty()) return;
+
+        // Occluders Always Use the Full Detail Triangles
+        GLuint count = mLods.empty() ? mIndices.size() : mLods[0].count;
+        occlusion.occluder(& mVertices.front().position, sizeof(Vertex),
+                           mIndices.data(), count, transform);
+    }
+
+    void Mesh::depth(GLuint shader, glm::mat4 const & model, glm::mat4 const & viewProjection)
+    {
+        // Casters Outside the View Still Cast, so Camera Culling Doesn't Apply;
+        // Skinned Submeshes Cast in their Bind Pose
+        if (mTransforms) mTransforms->update();
+        for (auto &i : mSubMeshes)
+            i->depth(shader, i->mNodes ? model * i->mNodes->world(i->mNode) : model, viewProjection);
+        if (mIndices.empty()) return;
+
+        glm::mat4 transform = viewProjection * model;
+        glUniformMatrix4fv(glGetUniformLocation(shader, "transform"), 1, GL_FALSE, glm::value_ptr(transform));
+        Lod lod = mLods.empty() ? Lod { 0, GLuint(mIndices.size()), 0.0f } : mLods[mLevel];
+        glBindVertexArray(mPositionArray);
+        glDrawElements(GL_TRIANGLES, lod.count, GL_UNSIGNED_INT,
+                      (GLvoid *) (lod.first * sizeof(GLuint)));
+    }
+
+    void Mesh::draw(GLuint shader, Pass & pass)
     {
         unsigned int unit = 0, diffuse = 0, specular = 0;
-        for (auto &i : mSubMeshes) i->draw(shader);
+        GLuint * bound = pass.bound;
+        for (auto &i : mSubMeshes) i->draw(shader, pass);
+        for (auto &i : mLayers)
+        {   // Rebind an Array Only When the Previous Submesh Sampled a Different One
+            if (bound[i.first] != i.second.layer.array)
+            {
+                glActiveTexture(GL_TEXTURE0 + i.first);
+                glBindTexture(GL_TEXTURE_2D_ARRAY, i.second.layer.array);
+                glUniform1i(glGetUniformLocation(shader, i.second.sampler.c_str()), i.first);
+                bound[i.first] = i.second.layer.array;
+            }   glUniform1i(glGetUniformLocation(shader, i.second.index.c_str()), i.second.layer.index);
+        }
         for (auto &i : mTextures)
-        {   // Set Correct Uniform Names Using Texture Type (Omit ID for 0th Texture)
-            std::string uniform = i.second;
-                 if (i.second == "diffuse")  uniform += (diffuse++  > 0) ? std::to_string(diffuse)  : "";
-            else if (i.second == "specular") uniform += (specular++ > 0) ? std::to_string(specular) : "";
+        {   // Set Correct Uniform Names Using Texture Type (Omit ID for 0th Texture);
+            // Formatted on the Stack so Drawing Never Touches the Heap
+            char uniform[32]; unsigned int index = 0;
+                 if (i.second == "diffuse")  index = ++diffuse;
+            else if (i.second == "specular") index = ++specular;
+            if (index > 1) snprintf(uniform, sizeof(uniform), "%s%u", i.second.c_str(), index);
+            else           snprintf(uniform, sizeof(uniform), "%s",   i.second.c_str());
 
             // Bind Correct Textures and Vertex Array Before Drawing
             glActiveTexture(GL_TEXTURE0 + unit);
             glBindTexture(GL_TEXTURE_2D, i.first);
-            glUniform1f(glGetUniformLocation(shader, uniform.c_str()), ++unit);
-        }   glBindVertexArray(mVertexArray);
-            glDrawElements(GL_TRIANGLES, mIndices.size(), GL_UNSIGNED_INT, 0);
+            glUniform1f(glGetUniformLocation(shader, uniform), ++unit);
+        }   if (mIndices.empty() || mCulled) return;
+
+        // Material Blocks Were Uploaded Once at Import
+        if (mMaterial) mMaterial->bind(MaterialBinding);
+
+        // Place the Submesh Where its Scene Node Says, as cull() and select() Did
+        glm::mat4 model = mNodes ? * pass.model * mNodes->world(mNode) : * pass.model;
+        glm::mat4 transform = * pass.viewProjection * model;
+        glUniformMatrix4fv(glGetUniformLocation(shader, "model"), 1, GL_FALSE, glm::value_ptr(model));
+        glUniformMatrix4fv(glGetUniformLocation(shader, "transform"), 1, GL_FALSE, glm::value_ptr(transform));
+
+        // Full Detail Meshlet Meshes Draw Only the Ranges that Survived cull()
+        if (mMeshlets && mLevel == 0)
+        {
+            auto & counts = mMeshlets->counts();
+            GLuint full = mLods.empty() ? GLuint(mIndices.size()) : mLods[0].count;
+            pass.stats.drawn += mMeshlets->indices() / 3;
+            pass.stats.saved += (full - mMeshlets->indices()) / 3;
+            glBindVertexArray(mVertexArray);
+            glMultiDrawElements(GL_TRIANGLES, counts.data(), GL_UNSIGNED_INT,
+                                mMeshlets->offsets().data(), counts.size());
+            return;
+        }
+
+        // Draw the Selected Range of the Element Buffer
+        Lod lod = mLods.empty() ? Lod { 0, GLuint(mIndices.size()), 0.0f } : mLods[mLevel];
+        pass.stats.drawn += lod.count / 3;
+        if (!mLods.empty()) pass.stats.saved += (mLods[0].count - lod.count) / 3;
+        glBindVertexArray(mVertexArray);
+        glDrawElements(GL_TRIANGLES, lod.count, GL_UNSIGNED_INT,
+                      (GLvoid *) (lod.first * sizeof(GLuint)));
     }
 
-    void Mesh::parse(std::string const & path, aiNode const * node, aiScene const * scene)
+    void Mesh::parse(std::string const & path, aiNode const * node, aiScene const * scene, int parent)
     {
+        unsigned int index = mTransforms->add(parent, convert(node->mTransformation));
         for (unsigned int i = 0; i < node->mNumMeshes; i++)
-            parse(path, scene->mMeshes[node->mMeshes[i]], scene);
+            parse(path, scene->mMeshes[node->mMeshes[i]], scene, node, index);
         for (unsigned int i = 0; i < node->mNumChildren; i++)
-            parse(path, node->mChildren[i], scene);
+            parse(path, node->mChildren[i], scene, int(index));
     }
 
-    void Mesh::parse(std::string const & path, aiMesh const * mesh, aiScene const * scene)
+    void Mesh::parse(std::string const & path, aiMesh const * mesh, aiScene const * scene,
+                     aiNode const * owner, unsigned int node)
     {
         // Create Vertex Data from Mesh Node
-        std::vector<Vertex> vertices; Vertex vertex;
+        std::vector<Vertex> vertices; Vertex vertex = {};
         for (unsigned int i = 0; i < mesh->mNumVertices; i++)
         {   if (mesh->mTextureCoords[0])
             vertex.uv       = glm::vec2(mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y);
@@ -102,6 +322,18 @@ namespace Mirage
             vertex.normal   = glm::vec3(mesh->mNormals[i].x,  mesh->mNormals[i].y,  mesh->mNormals[i].z);
             vertices.push_back(vertex);
         }
+        if (mSkeleton && mesh->HasBones()) skin(mesh, vertices);
+        else if (mSkeleton)
+        {   // Rigid Parts of Skinned Models Follow their Node Through the Palette
+            glm::mat4 bind; GLubyte bone = mSkeleton->rigid(owner->mName.C_Str(), bind);
+            glm::mat4 normals = glm::transpose(glm::inverse(bind));
+            for (auto &i : vertices)
+            {
+                i.position = glm::vec3(bind * glm::vec4(i.position, 1.0f));
+                i.normal   = glm::normalize(glm::vec3(normals * glm::vec4(i.normal, 0.0f)));
+                i.bones[0] = bone, i.weights[0] = 255;
+            }
+        }
 
         // Create Mesh Indices for Indexed Drawing
         std::vector<GLuint> indices;
@@ -109,15 +341,100 @@ namespace Mirage
         for (unsigned int j = 0; j < mesh->mFaces[i].mNumIndices; j++)
             indices.push_back(mesh->mFaces[i].mIndices[j]);
 
-        // Load Mesh Textures into VRAM
+        // Cluster the Full Detail Triangles Before Coarser Levels are Appended
+        std::unique_ptr<Meshlets> meshlets;
+        if (mFlags & ImportMeshlets) meshlets.reset(new Meshlets(vertices, indices));
+
+        // Append Coarser Index Lists that Reuse the Same Vertices
+        std::vector<Lod> lods;
+        if (mFlags & ImportGenerateLods) lods = simplify(vertices, indices);
+
+        // Packed Imports Only Record Which Array Layer to Sample
         std::map<GLuint, std::string> textures;
-        auto diffuse  = process(path, scene->mMaterials[mesh->mMaterialIndex], aiTextureType_DIFFUSE);
-        auto specular = process(path, scene->mMaterials[mesh->mMaterialIndex], aiTextureType_SPECULAR);
-        textures.insert(diffuse.begin(), diffuse.end());
-        textures.insert(specular.begin(), specular.end());
+        std::map<GLuint, Slot> layers;
+        if (mArrays)
+        {
+            layers        = pack(path, scene->mMaterials[mesh->mMaterialIndex], aiTextureType_DIFFUSE);
+            auto specular = pack(path, scene->mMaterials[mesh->mMaterialIndex], aiTextureType_SPECULAR);
+            layers.insert(specular.begin(), specular.end());
+        }
+        else
+        {   // Load Mesh Textures into VRAM
+            auto diffuse  = process(path, scene->mMaterials[mesh->mMaterialIndex], aiTextureType_DIFFUSE);
+            auto specular = process(path, scene->mMaterials[mesh->mMaterialIndex], aiTextureType_SPECULAR);
+            textures.insert(diffuse.begin(), diffuse.end());
+            textures.insert(specular.begin(), specular.end());
+        }
 
         // Create New Mesh Node
         mSubMeshes.push_back(std::unique_ptr<Mesh>(new Mesh(vertices, indices, textures)));
+        auto & submesh = * mSubMeshes.back();
+        submesh.mLayers = layers;
+        submesh.mLods = lods;
+        submesh.mMeshlets = std::move(meshlets);
+        submesh.mMaterial = block(scene->mMaterials[mesh->mMaterialIndex], layers);
+
+        // Bone Palettes Already Carry the Node Hierarchy, Rigid Parts Included
+        if (!mSkeleton) submesh.mNodes = mTransforms.get();
+        submesh.mNode = node;
+
+        // Bound the Submesh with a Sphere Around its Box for LOD Selection
+        if (vertices.empty()) return;
+        glm::vec3 lower = vertices.front().position, upper = lower;
+        for (auto &i : vertices) lower = glm::min(lower, i.position), upper = glm::max(upper, i.position);
+        submesh.mLower  = lower;
+        submesh.mUpper  = upper;
+        submesh.mCenter = (lower + upper) * 0.5f;
+        for (auto &i : vertices) submesh.mRadius = glm::max(submesh.mRadius, glm::distance(submesh.mCenter, i.position));
+    }
+
+    void Mesh::skin(aiMesh const * mesh, std::vector<Vertex> & vertices)
+    {
+        // Keep the Four Strongest Influences on Each Vertex
+        std::vector<float> weights(vertices.size() * 4, 0.0f);
+        for (unsigned int i = 0; i < mesh->mNumBones; i++)
+        {
+            GLubyte bone = mSkeleton->bone(mesh->mBones[i]);
+            for (unsigned int j = 0; j < mesh->mBones[i]->mNumWeights; j++)
+            {
+                auto const & influence = mesh->mBones[i]->mWeights[j];
+                if (influence.mVertexId >= vertices.size()) continue;
+                float * slots = & weights[influence.mVertexId * 4];
+                int weakest = int(std::min_element(slots, slots + 4) - slots);
+                if (influence.mWeight <= slots[weakest]) continue;
+                slots[weakest] = influence.mWeight;
+                vertices[influence.mVertexId].bones[weakest] = bone;
+            }
+        }
+
+        // Quantize to Bytes, Giving Rounding Error to the Strongest Influence
+        for (std::size_t i = 0; i < vertices.size(); i++)
+        {
+            float const * slots = & weights[i * 4];
+            float total = slots[0] + slots[1] + slots[2] + slots[3];
+            if (total <= 0.0f) continue;
+            int sum = 0, strongest = int(std::max_element(slots, slots + 4) - slots);
+            for (int j = 0; j < 4; j++)
+                sum += vertices[i].weights[j] = GLubyte(slots[j] / total * 255.0f + 0.5f);
+            vertices[i].weights[strongest] = GLubyte(vertices[i].weights[strongest] + 255 - sum);
+        }
+    }
+
+    std::vector<Lod> Mesh::simplify(std::vector<Vertex> const & vertices,
+                                    std::vector<GLuint> & indices)
+    {
+        // Halve the Triangle Count per Level Until the Simplifier Stalls
+        std::vector<Lod> lods { Lod { 0, GLuint(indices.size()), 0.0f } };
+        std::vector<GLuint> level(indices);
+        while (lods.size() < kLods)
+        {
+            float error;
+            auto coarser = Mirage::simplify(vertices, level, level.size() / 6 * 3, & error);
+            if (coarser.empty() || coarser.size() > level.size() * 3 / 4) break;
+            lods.push_back(Lod { GLuint(indices.size()), GLuint(coarser.size()), error });
+            indices.insert(indices.end(), coarser.begin(), coarser.end());
+            level.swap(coarser);
+        }   return lods;
     }
 
     std::map<GLuint, std::string> Mesh::process(std::string const & path,
@@ -136,7 +453,10 @@ namespace Mirage
             aiString str; material->GetTexture(type, i, & str);
             std::string filename = str.C_Str(); int width, height, channels;
             filename = PROJECT_SOURCE_DIR "/Mirage/Models/" + path + "/" + filename;
-            unsigned char * image = stbi_load(filename.c_str(), & width, & height, & channels, 0);
+            Span span; std::vector<unsigned char> scratch;
+            unsigned char * image = Package::lookup(filename, span, scratch)
+                ? stbi_load_from_memory(span.data, int(span.size), & width, & height, & channels, 0)
+                : stbi_load(filename.c_str(), & width, & height, & channels, 0);
             if (!image) fprintf(stderr, "%s %s\n", "Failed to Load Texture", filename.c_str());
 
             // Set the Correct Channel Format
@@ -166,4 +486,46 @@ namespace Mirage
             textures.insert(std::make_pair(texture, mode));
         }   return textures;
     }
+
+    std::map<GLuint, Slot> Mesh::pack(std::string const & path,
+                                      aiMaterial * material,
+                                      aiTextureType type)
+    {
+        std::map<GLuint, Slot> slots;
+        for (unsigned int i = 0; i < material->GetTextureCount(type); i++)
+        {
+            // Diffuse Maps Take Even Units and Specular Maps Take Odd Units
+            GLuint unit = 2 * i + (type == aiTextureType_SPECULAR);
+            if (unit >= kUnits) break;
+
+            // Name the Sampler Like draw() Does (Omit ID for 0th Texture)
+            std::string mode = (type == aiTextureType_DIFFUSE) ? "diffuse" : "specular";
+            std::string uniform = mode + ((i > 0) ? std::to_string(i + 1) : "");
+
+            // Load the Texture Image into its Array
+            aiString str; material->GetTexture(type, i, & str);
+            std::string filename = PROJECT_SOURCE_DIR "/Mirage/Models/" + path + "/" + str.C_Str();
+            Layer layer = mArrays->insert(filename);
+            if (layer.index < 0) continue;
+            slots.insert(std::make_pair(unit, Slot { uniform, uniform + "_layer", layer }));
+        }   return slots;
+    }
+
+    std::unique_ptr<UniformBuffer> Mesh::block(aiMaterial * material,
+                                               std::map<GLuint, Slot> const & layers)
+    {
+        // Keys the Material Lacks Keep these Defaults
+        aiColor4D diffuse(1.0f, 1.0f, 1.0f, 1.0f), specular(0.0f, 0.0f, 0.0f, 0.0f);
+        float shininess = 0.0f;
+        material->Get(AI_MATKEY_COLOR_DIFFUSE,  diffuse);
+        material->Get(AI_MATKEY_COLOR_SPECULAR, specular);
+        material->Get(AI_MATKEY_SHININESS,      shininess);
+
+        // Packed Layers Follow the Units pack() Assigned; -1 Means Unused
+        MaterialBlock block = { glm::vec4(diffuse.r, diffuse.g, diffuse.b, diffuse.a),
+                                glm::vec4(specular.r, specular.g, specular.b, shininess),
+                                { -1, -1, -1, -1 } };
+        for (auto &i : layers) if (i.first < 4) block.layers[i.first] = i.second.layer.index;
+        return std::unique_ptr<UniformBuffer>(new UniformBuffer(sizeof(MaterialBlock), & block, GL_STATIC_DRAW));
+    }
 };
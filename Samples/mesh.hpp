@@ -7,6 +7,15 @@
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
+// Local Headers
+#include "animation.hpp"
+#include "lod.hpp"
+#include "meshlet.hpp"
+#include "occlusion.hpp"
+#include "texture.hpp"
+#include "transform.hpp"
+#include "uniforms.hpp"
+
 // Standard Headers
 #include <map>
 #include <memory>
@@ -15,11 +24,41 @@
 // Define Namespace
 namespace Mirage
 {
-    // Vertex Format
+    // Vertex Format; Up to Four Bone Influences with Weights Summing to 255
     struct Vertex {
         glm::vec3 position;
         glm::vec3 normal;
         glm::vec2 uv;
+        GLubyte   bones[4];
+        GLubyte   weights[4];
+    };
+
+    // Import Options
+    enum ImportFlags : unsigned int {
+        ImportDefault      = 0,
+        ImportPackTextures = 1 << 0, // Share GL_TEXTURE_2D_ARRAYs Across Submeshes
+        ImportGenerateLods = 1 << 1, // Append Simplified Index Lists per Submesh
+        ImportMeshlets     = 1 << 2, // Split Submeshes into Individually Culled Clusters
+    };
+
+    // Range of the Element Buffer Holding One Level of Detail
+    struct Lod {
+        GLuint first;
+        GLuint count;
+        float  error;
+    };
+
+    // Triangles Drawn and Skipped by Level of Detail Selection and Meshlet Culling
+    struct LodStats {
+        unsigned int drawn;
+        unsigned int saved;
+    };
+
+    // Packed Texture Bound to a Fixed Unit
+    struct Slot {
+        std::string sampler;
+        std::string index;
+        Layer layer;
     };
 
     class Mesh
@@ -28,16 +67,25 @@ namespace Mirage
 
         // Implement Default Constructor and Destructor
          Mesh() { glGenVertexArrays(1, & mVertexArray); }
-        ~Mesh() { glDeleteVertexArrays(1, & mVertexArray); }
+        ~Mesh() { glDeleteVertexArrays(1, & mVertexArray); glDeleteVertexArrays(1, & mPositionArray); }
 
         // Implement Custom Constructors
-        Mesh(std::string const & filename);
+        Mesh(std::string const & filename, unsigned int flags = ImportDefault);
         Mesh(std::vector<Vertex> const & vertices,
              std::vector<GLuint> const & indices,
              std::map<GLuint, std::string> const & textures);
 
         // Public Member Functions
-        void draw(GLuint shader);
+        void draw(GLuint shader, glm::mat4 const & model, glm::mat4 const & viewProjection);
+        void select(glm::vec3 const & eye, float scale);
+        void cull(glm::mat4 const & transform, glm::vec3 const & eye,
+                  Occlusion const * occlusion = nullptr);
+        void occlude(Occlusion & occlusion, glm::mat4 const & transform) const;
+        void depth(GLuint shader, glm::mat4 const & model, glm::mat4 const & viewProjection);
+        LodStats stats() const { return mStats; }
+        Skeleton const * skeleton() const { return mSkeleton.get(); }
+        std::vector<Clip> const & clips() const { return mClips; }
+        Transforms * transforms() const { return mTransforms.get(); }
 
     private:
 
@@ -45,23 +93,67 @@ namespace Mirage
         Mesh(Mesh const &) = delete;
         Mesh & operator=(Mesh const &) = delete;
 
+        // Texture Units and Detail Levels Available to Each Submesh
+        static const GLuint kUnits = 16;
+        static const GLuint kLods  = kLodLevels;
+
+        // State Shared by Every Submesh During a Single draw()
+        struct Pass {
+            GLuint bound[kUnits];
+            LodStats stats;
+            glm::mat4 const * model;
+            glm::mat4 const * viewProjection;
+        };
+
         // Private Member Functions
-        void parse(std::string const & path, aiNode const * node, aiScene const * scene);
-        void parse(std::string const & path, aiMesh const * mesh, aiScene const * scene);
+        void draw(GLuint shader, Pass & pass);
+        void cull(Frustum const & frustum, glm::mat4 const & transform,
+                  glm::vec3 const & eye, Occlusion const * occlusion);
+        void parse(std::string const & path, aiNode const * node, aiScene const * scene, int parent);
+        void parse(std::string const & path, aiMesh const * mesh, aiScene const * scene,
+                   aiNode const * owner, unsigned int node);
         std::map<GLuint, std::string> process(std::string const & path,
                                               aiMaterial * material,
                                               aiTextureType type);
+        std::map<GLuint, Slot> pack(std::string const & path,
+                                    aiMaterial * material,
+                                    aiTextureType type);
+        std::vector<Lod> simplify(std::vector<Vertex> const & vertices,
+                                  std::vector<GLuint> & indices);
+        void skin(aiMesh const * mesh, std::vector<Vertex> & vertices);
+        std::unique_ptr<UniformBuffer> block(aiMaterial * material,
+                                             std::map<GLuint, Slot> const & layers);
 
         // Private Member Containers
         std::vector<std::unique_ptr<Mesh>> mSubMeshes;
         std::vector<GLuint> mIndices;
         std::vector<Vertex> mVertices;
         std::map<GLuint, std::string> mTextures;
+        std::map<GLuint, Slot> mLayers;
+        std::unique_ptr<TextureArrays> mArrays;
+        std::vector<Lod> mLods;
+        std::unique_ptr<Meshlets> mMeshlets;
+        std::unique_ptr<Skeleton> mSkeleton;
+        std::vector<Clip> mClips;
+        std::unique_ptr<Transforms> mTransforms;
+        std::unique_ptr<UniformBuffer> mMaterial;
 
         // Private Member Variables
+        unsigned int mFlags = ImportDefault;
+        unsigned int mLevel = 0;
+        unsigned int mNode = 0;
+        Transforms * mNodes = nullptr;
+        bool      mCulled = false;
+        LodStats  mStats = { 0, 0 };
+        glm::vec3 mCenter;
+        glm::vec3 mLower;
+        glm::vec3 mUpper;
+        float     mRadius = 0.0f;
         GLuint mVertexArray;
         GLuint mVertexBuffer;
         GLuint mElementBuffer;
+        GLuint mPositionArray = 0;
+        GLuint mPositionBuffer;
 
     };
 };
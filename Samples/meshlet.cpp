@@ -0,0 +1,170 @@
+// Local Headers
+#include "meshlet.hpp"
+#include "mesh.hpp"
+
+// System Headers
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
+// Standard Headers
+#include <cmath>
+
+// Define Namespace
+namespace Mirage
+{
+    Meshlets::Meshlets(std::vector<Vertex> const & vertices, std::vector<GLuint> const & indices)
+    {
+        // Stamp Vertices with the Meshlet that Last Referenced Them
+        std::vector<GLuint> stamp(vertices.size(), ~0u);
+        Meshlet meshlet = { 0, 0, glm::vec3(), 0.0f, glm::vec3(), 0.0f };
+        unsigned int unique = 0;
+        for (std::size_t i = 0; i + 2 < indices.size(); i += 3)
+        {
+            // Count Vertices this Triangle Would Add to the Current Meshlet
+            GLuint id = mMeshlets.size();
+            GLuint a = indices[i], b = indices[i + 1], c = indices[i + 2];
+            unsigned int added = (stamp[a] != id) + (stamp[b] != id && b != a)
+                               + (stamp[c] != id && c != a && c != b);
+
+            // Close the Meshlet Once Either Limit Would Be Exceeded
+            if (unique + added > kVertices || meshlet.count / 3 + 1 > kTriangles)
+            {
+                bound(vertices, indices, meshlet);
+                mMeshlets.push_back(meshlet);
+                meshlet.first = i;
+                meshlet.count = unique = 0;
+                id = mMeshlets.size();
+                added = 3 - (b == a) - (c == a || c == b);
+            }
+
+            stamp[a] = stamp[b] = stamp[c] = id;
+            unique += added;
+            meshlet.count += 3;
+        }
+
+        if (meshlet.count > 0)
+        {
+            bound(vertices, indices, meshlet);
+            mMeshlets.push_back(meshlet);
+        }
+
+        // Transpose Bounds, Padding to a Multiple of Four with Empty Entries
+        std::size_t padded = (mMeshlets.size() + 3) & ~std::size_t(3);
+        for (auto v : { & mCenterX, & mCenterY, & mCenterZ, & mRadius,
+                        & mAxisX,   & mAxisY,   & mAxisZ,   & mCutoff }) v->resize(padded, 0.0f);
+        for (std::size_t i = 0; i < mMeshlets.size(); i++)
+        {
+            auto & m = mMeshlets[i];
+            mCenterX[i] = m.center.x; mCenterY[i] = m.center.y; mCenterZ[i] = m.center.z;
+            mAxisX[i]   = m.axis.x;   mAxisY[i]   = m.axis.y;   mAxisZ[i]   = m.axis.z;
+            mRadius[i]  = m.radius;   mCutoff[i]  = m.cutoff;
+        }
+
+        // Everything is Visible Until the First cull()
+        for (std::size_t i = 0; i < mMeshlets.size(); i++) emit(i);
+    }
+
+    void Meshlets::bound(std::vector<Vertex> const & vertices,
+                         std::vector<GLuint> const & indices, Meshlet & meshlet)
+    {
+        // Bounding Sphere Centered on the Box
+        glm::vec3 lower = vertices[indices[meshlet.first]].position, upper = lower;
+        for (GLuint i = meshlet.first; i < meshlet.first + meshlet.count; i++)
+        {
+            lower = glm::min(lower, vertices[indices[i]].position);
+            upper = glm::max(upper, vertices[indices[i]].position);
+        }
+
+        meshlet.center = (lower + upper) * 0.5f;
+        meshlet.radius = 0.0f;
+        for (GLuint i = meshlet.first; i < meshlet.first + meshlet.count; i++)
+            meshlet.radius = glm::max(meshlet.radius, glm::distance(meshlet.center, vertices[indices[i]].position));
+
+        // Cone Axis is the Mean Face Normal; its Spread Bounds the Rest
+        std::vector<glm::vec3> normals;
+        glm::vec3 axis(0.0f);
+        for (GLuint i = meshlet.first; i < meshlet.first + meshlet.count; i += 3)
+        {
+            glm::vec3 p0 = vertices[indices[i]].position;
+            glm::vec3 normal = glm::cross(vertices[indices[i + 1]].position - p0,
+                                          vertices[indices[i + 2]].position - p0);
+            float area = glm::length(normal);
+            if (area == 0.0f) continue;
+            normals.push_back(normal / area);
+            axis += normals.back();
+        }
+
+        // Cones Wider than a Hemisphere Can Never Be Entirely Back-Facing
+        float spread = 1.0f;
+        if (glm::length(axis) > 0.0f) axis = glm::normalize(axis);
+        for (auto &n : normals) spread = glm::min(spread, glm::dot(axis, n));
+        meshlet.axis = axis;
+        meshlet.cutoff = (normals.empty() || spread <= 0.0f) ? 2.0f : std::sqrt(1.0f - spread * spread);
+    }
+
+    void Meshlets::cull(Frustum const & frustum, glm::vec3 const & eye)
+    {
+        mCounts.clear();
+        mOffsets.clear();
+        mVisible = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+        __m128 ex = _mm_set1_ps(eye.x), ey = _mm_set1_ps(eye.y), ez = _mm_set1_ps(eye.z);
+        for (std::size_t i = 0; i < mMeshlets.size(); i += 4)
+        {
+            __m128 cx = _mm_loadu_ps(& mCenterX[i]), cy = _mm_loadu_ps(& mCenterY[i]);
+            __m128 cz = _mm_loadu_ps(& mCenterZ[i]), r  = _mm_loadu_ps(& mRadius[i]);
+            __m128 nr = _mm_sub_ps(_mm_setzero_ps(), r);
+
+            // Keep Spheres in Front of Every Plane
+            __m128 visible = _mm_cmpeq_ps(r, r);
+            for (int j = 0; j < 6; j++)
+            {
+                auto const & p = frustum.plane(j);
+                __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, _mm_set1_ps(p.x)),
+                                                 _mm_mul_ps(cy, _mm_set1_ps(p.y))),
+                                      _mm_add_ps(_mm_mul_ps(cz, _mm_set1_ps(p.z)), _mm_set1_ps(p.w)));
+                visible = _mm_and_ps(visible, _mm_cmpge_ps(d, nr));
+            }
+
+            // Drop Clusters Whose Normal Cone Points Entirely Away from the Eye
+            __m128 vx = _mm_sub_ps(cx, ex), vy = _mm_sub_ps(cy, ey), vz = _mm_sub_ps(cz, ez);
+            __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)));
+            __m128 facing = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, _mm_loadu_ps(& mAxisX[i])),
+                                                  _mm_mul_ps(vy, _mm_loadu_ps(& mAxisY[i]))),
+                                                  _mm_mul_ps(vz, _mm_loadu_ps(& mAxisZ[i])));
+            __m128 limit = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(& mCutoff[i]), length), r);
+            visible = _mm_andnot_ps(_mm_cmpge_ps(facing, limit), visible);
+
+            int mask = _mm_movemask_ps(visible);
+            for (std::size_t j = 0; j < 4 && i + j < mMeshlets.size(); j++)
+                if (mask & (1 << j)) emit(i + j);
+        }
+#else
+        for (std::size_t i = 0; i < mMeshlets.size(); i++)
+        {
+            auto const & m = mMeshlets[i];
+            glm::vec3 view = m.center - eye;
+            if (!frustum.visible(m.center, m.radius)) continue;
+            if (glm::dot(view, m.axis) >= m.cutoff * glm::length(view) + m.radius) continue;
+            emit(i);
+        }
+#endif
+    }
+
+    void Meshlets::emit(std::size_t i)
+    {
+        // Extend the Previous Range When this Meshlet Directly Follows It
+        auto const & m = mMeshlets[i];
+        mVisible += m.count;
+        if (!mCounts.empty() && (std::size_t) mOffsets.back() / sizeof(GLuint) + mCounts.back() == m.first)
+        {
+            mCounts.back() += m.count;
+            return;
+        }
+
+        mCounts.push_back(m.count);
+        mOffsets.push_back((GLvoid const *) (m.first * sizeof(GLuint)));
+    }
+};
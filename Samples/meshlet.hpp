@@ -0,0 +1,74 @@
+#pragma once
+
+// Local Headers
+#include "frustum.hpp"
+
+// System Headers
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    struct Vertex;
+
+    // Small Cluster of Triangles with Bounds for Culling
+    struct Meshlet {
+        GLuint first;     // Offset into the Reordered Index Buffer
+        GLuint count;     // Number of Indices
+        glm::vec3 center; // Bounding Sphere
+        float radius;
+        glm::vec3 axis;   // Normal Cone; Back-Facing if dot(center - eye, axis)
+        float cutoff;     //   >= cutoff * length(center - eye) + radius
+    };
+
+    class Meshlets
+    {
+    public:
+
+        // Cluster Limits Matching Common Mesh Shader Output Sizes
+        static const unsigned int kVertices  = 64;
+        static const unsigned int kTriangles = 124;
+
+        // Split a Triangle List into Meshlets of Consecutive Triangles, so Each
+        // Meshlet is Already a Contiguous Range of the Existing Index Buffer
+        Meshlets(std::vector<Vertex> const & vertices, std::vector<GLuint> const & indices);
+
+        // Cull Against a Frustum and Eye Position (Both in Model Space), then
+        // Merge Adjacent Survivors into as Few Index Ranges as Possible
+        void cull(Frustum const & frustum, glm::vec3 const & eye);
+
+        // Public Member Functions
+        std::vector<Meshlet> const & meshlets() const { return mMeshlets; }
+        std::vector<GLsizei> const & counts()   const { return mCounts; }
+        std::vector<GLvoid const *> const & offsets() const { return mOffsets; }
+        unsigned int indices() const { return mVisible; }
+
+    private:
+
+        // Disable Copying and Assignment
+        Meshlets(Meshlets const &) = delete;
+        Meshlets & operator=(Meshlets const &) = delete;
+
+        // Private Member Functions
+        void bound(std::vector<Vertex> const & vertices,
+                   std::vector<GLuint> const & indices, Meshlet & meshlet);
+        void emit(std::size_t i);
+
+        // Private Member Containers
+        std::vector<Meshlet> mMeshlets;
+        std::vector<GLsizei> mCounts;
+        std::vector<GLvoid const *> mOffsets;
+
+        // Bounds Transposed into Padded Arrays for Four-Wide Culling
+        std::vector<float> mCenterX, mCenterY, mCenterZ, mRadius;
+        std::vector<float> mAxisX, mAxisY, mAxisZ, mCutoff;
+
+        // Private Member Variables
+        unsigned int mVisible = 0;
+
+    };
+};
@@ -0,0 +1,201 @@
+// Local Headers
+#include "occlusion.hpp"
+
+// System Headers
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
+// Standard Headers
+#include <algorithm>
+
+// Define Namespace
+namespace Mirage
+{
+    // Triangles Crossing the Near Plane are Skipped; Dropping an Occluder
+    // Only Ever Makes the Test More Conservative
+    static const float kNear = 1e-4f;
+
+    Occlusion::Occlusion(Scheduler & scheduler, int width, int height)
+        : mBins((width / kTile) * (height / kTile))
+        , mDepth(width * height)
+        , mFarthest((width / kBlock) * (height / kBlock))
+        , mScheduler(scheduler)
+        , mWidth(width)
+        , mHeight(height)
+        , mTilesX(width / kTile)
+        , mTilesY(height / kTile)
+    {
+        clear();
+    }
+
+    void Occlusion::clear()
+    {
+        mTriangles.clear();
+        for (auto &i : mBins) i.clear();
+        std::fill(mDepth.begin(), mDepth.end(), 1.0f);
+        std::fill(mFarthest.begin(), mFarthest.end(), 1.0f);
+    }
+
+    void Occlusion::occluder(glm::vec3 const * positions, std::size_t stride,
+                             GLuint const * indices, std::size_t count,
+                             glm::mat4 const & transform)
+    {
+        char const * base = reinterpret_cast<char const *>(positions);
+        for (std::size_t i = 0; i + 2 < count; i += 3)
+        {
+            // Project to Window Coordinates with Depth in [0, 1]
+            Triangle t; glm::vec3 p[3]; bool clipped = false;
+            for (int j = 0; j < 3; j++)
+            {
+                auto const & v = * reinterpret_cast<glm::vec3 const *>(base + indices[i + j] * stride);
+                glm::vec4 clip = transform * glm::vec4(v, 1.0f);
+                if (clip.w < kNear) { clipped = true; break; }
+                p[j] = glm::vec3((clip.x / clip.w * 0.5f + 0.5f) * mWidth,
+                                 (clip.y / clip.w * 0.5f + 0.5f) * mHeight,
+                                  clip.z / clip.w * 0.5f + 0.5f);
+            }   if (clipped) continue;
+
+            // Orient Counter-Clockwise so Inside Means Every Edge is Positive
+            float area = (p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[1].y - p[0].y) * (p[2].x - p[0].x);
+            if (area == 0.0f) continue;
+            if (area < 0.0f) { std::swap(p[1], p[2]); area = -area; }
+
+            // Solve the Plane z = z0 + dzdx * x + dzdy * y
+            t.dzdx = ((p[1].z - p[0].z) * (p[2].y - p[0].y) - (p[2].z - p[0].z) * (p[1].y - p[0].y)) / area;
+            t.dzdy = ((p[2].z - p[0].z) * (p[1].x - p[0].x) - (p[1].z - p[0].z) * (p[2].x - p[0].x)) / area;
+            t.z = p[0].z - t.dzdx * p[0].x - t.dzdy * p[0].y;
+            for (int j = 0; j < 3; j++) t.x[j] = p[j].x, t.y[j] = p[j].y;
+
+            // Skip Triangles Entirely Off-Screen
+            t.minX = std::max(0, int(std::min({ p[0].x, p[1].x, p[2].x })));
+            t.minY = std::max(0, int(std::min({ p[0].y, p[1].y, p[2].y })));
+            t.maxX = std::min(mWidth  - 1, int(std::max({ p[0].x, p[1].x, p[2].x })));
+            t.maxY = std::min(mHeight - 1, int(std::max({ p[0].y, p[1].y, p[2].y })));
+            if (t.minX > t.maxX || t.minY > t.maxY) continue;
+            mTriangles.push_back(t);
+        }
+    }
+
+    void Occlusion::rasterize()
+    {
+        // Bin Triangles into Every Tile their Bounds Overlap
+        for (GLuint i = 0; i < mTriangles.size(); i++)
+        {
+            auto const & t = mTriangles[i];
+            for (int y = t.minY / kTile; y <= t.maxY / kTile; y++)
+            for (int x = t.minX / kTile; x <= t.maxX / kTile; x++)
+                mBins[y * mTilesX + x].push_back(i);
+        }
+
+        // Tiles Share No Pixels, so Each Job Owns its Tile Outright
+        mScheduler.parallel_for(mBins.size(), 1, [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) rasterize(int(i));
+        });
+    }
+
+    void Occlusion::rasterize(int tile)
+    {
+        int tileX = (tile % mTilesX) * kTile, tileY = (tile / mTilesX) * kTile;
+        for (auto index : mBins[tile])
+        {
+            auto const & t = mTriangles[index];
+
+            // Edge Functions as a * x + b * y + c, Positive Inside
+            float a[3], b[3], c[3];
+            for (int j = 0; j < 3; j++)
+            {
+                int k = (j + 1) % 3;
+                a[j] = t.y[j] - t.y[k];
+                b[j] = t.x[k] - t.x[j];
+                c[j] = (t.y[k] - t.y[j]) * t.x[j] - (t.x[k] - t.x[j]) * t.y[j];
+            }
+
+            // Clip Bounds to the Tile, Aligning Columns to Groups of Four
+            int minX = std::max(t.minX, tileX) & ~3, maxX = std::min(t.maxX, tileX + kTile - 1);
+            int minY = std::max(t.minY, tileY),      maxY = std::min(t.maxY, tileY + kTile - 1);
+            for (int y = minY; y <= maxY; y++)
+            {
+                float py = y + 0.5f;
+                float * row = & mDepth[y * mWidth];
+#if defined(__SSE2__) || defined(_M_X64)
+                __m128 zero = _mm_setzero_ps(), step = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+                for (int x = minX; x <= maxX; x += 4)
+                {
+                    __m128 px = _mm_add_ps(_mm_set1_ps(float(x)), step);
+                    __m128 inside = _mm_cmpeq_ps(zero, zero);
+                    for (int j = 0; j < 3; j++)
+                    {
+                        __m128 e = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[j]), px), _mm_set1_ps(b[j] * py + c[j]));
+                        inside = _mm_and_ps(inside, _mm_cmpge_ps(e, zero));
+                    }
+
+                    // Keep the Nearer Depth Wherever the Triangle Covers
+                    __m128 z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.dzdx), px), _mm_set1_ps(t.dzdy * py + t.z));
+                    __m128 old = _mm_loadu_ps(row + x);
+                    __m128 nearest = _mm_min_ps(old, z);
+                    _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, old)));
+                }
+#else
+                for (int x = minX; x <= maxX; x++)
+                {
+                    float px = x + 0.5f;
+                    if (a[0] * px + b[0] * py + c[0] < 0.0f ||
+                        a[1] * px + b[1] * py + c[1] < 0.0f ||
+                        a[2] * px + b[2] * py + c[2] < 0.0f) continue;
+                    row[x] = std::min(row[x], t.dzdx * px + t.dzdy * py + t.z);
+                }
+#endif
+            }
+        }
+
+        // Reduce the Tile to the Farthest Depth in Each Block
+        for (int by = tileY; by < tileY + kTile; by += kBlock)
+        for (int bx = tileX; bx < tileX + kTile; bx += kBlock)
+        {
+            float farthest = 0.0f;
+            for (int y = by; y < by + kBlock; y++)
+            for (int x = bx; x < bx + kBlock; x++) farthest = std::max(farthest, mDepth[y * mWidth + x]);
+            mFarthest[(by / kBlock) * (mWidth / kBlock) + bx / kBlock] = farthest;
+        }
+    }
+
+    bool Occlusion::visible(glm::vec3 const & lower, glm::vec3 const & upper,
+                            glm::mat4 const & transform) const
+    {
+        // Project the Box Corners, Tracking Screen Bounds and Nearest Depth
+        float minX = mWidth, minY = mHeight, maxX = 0.0f, maxY = 0.0f, nearest = 1.0f;
+        for (int i = 0; i < 8; i++)
+        {
+            glm::vec3 corner((i & 1) ? upper.x : lower.x,
+                             (i & 2) ? upper.y : lower.y,
+                             (i & 4) ? upper.z : lower.z);
+            glm::vec4 clip = transform * glm::vec4(corner, 1.0f);
+            if (clip.w < kNear) return true; // Straddles the Camera
+            float x = (clip.x / clip.w * 0.5f + 0.5f) * mWidth;
+            float y = (clip.y / clip.w * 0.5f + 0.5f) * mHeight;
+            minX = std::min(minX, x); maxX = std::max(maxX, x);
+            minY = std::min(minY, y); maxY = std::max(maxY, y);
+            nearest = std::min(nearest, clip.z / clip.w * 0.5f + 0.5f);
+        }
+
+        // Boxes Entirely Off-Screen Can't Be Seen Either
+        if (maxX < 0.0f || maxY < 0.0f || minX >= mWidth || minY >= mHeight) return false;
+        int stride = mWidth / kBlock;
+        int x0 = std::max(0, int(minX)) / kBlock, x1 = std::min(mWidth  - 1, int(maxX)) / kBlock;
+        int y0 = std::max(0, int(minY)) / kBlock, y1 = std::min(mHeight - 1, int(maxY)) / kBlock;
+
+        // Visible if the Box is Nearer than the Farthest Occluder in Any Block
+        for (int y = y0; y <= y1; y++)
+        {
+            float const * row = & mFarthest[y * stride];
+            int x = x0;
+#if defined(__SSE2__) || defined(_M_X64)
+            __m128 z = _mm_set1_ps(nearest);
+            for (; x + 3 <= x1; x += 4)
+                if (_mm_movemask_ps(_mm_cmple_ps(z, _mm_loadu_ps(row + x)))) return true;
+#endif
+            for (; x <= x1; x++) if (nearest <= row[x]) return true;
+        }   return false;
+    }
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+// Local Headers
+#include "jobs.hpp"
+
+// System Headers
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // CPU Occlusion Culling: Occluders are Rasterized with SSE into a Small
+    // Depth Buffer, Tile by Tile Across Threads, then Reduced to the Farthest
+    // Depth per 8x8 Block so Boxes Can be Tested Against a Handful of Values.
+    class Occlusion
+    {
+    public:
+
+        // Dimensions Must be Multiples of the Tile Size
+        static const int kTile  = 32;
+        static const int kBlock = 8;
+
+        // Implement Custom Constructor
+        Occlusion(Scheduler & scheduler, int width = 256, int height = 128);
+
+        // Queue Occluder Triangles; Transform Maps them to Clip Space
+        void occluder(glm::vec3 const * positions, std::size_t stride,
+                      GLuint const * indices, std::size_t count,
+                      glm::mat4 const & transform);
+
+        // Public Member Functions
+        void clear();
+        void rasterize();
+        bool visible(glm::vec3 const & lower, glm::vec3 const & upper,
+                     glm::mat4 const & transform) const;
+
+    private:
+
+        // Disable Copying and Assignment
+        Occlusion(Occlusion const &) = delete;
+        Occlusion & operator=(Occlusion const &) = delete;
+
+        // Screen-Space Triangle with a Depth Plane
+        struct Triangle {
+            float x[3], y[3];
+            float dzdx, dzdy, z;
+            int minX, minY, maxX, maxY;
+        };
+
+        // Private Member Functions
+        void rasterize(int tile);
+
+        // Private Member Containers
+        std::vector<Triangle> mTriangles;
+        std::vector<std::vector<GLuint>> mBins;
+        std::vector<float> mDepth;
+        std::vector<float> mFarthest;
+
+        // Private Member Variables
+        Scheduler & mScheduler;
+        int mWidth;
+        int mHeight;
+        int mTilesX;
+        int mTilesY;
+
+    };
+};
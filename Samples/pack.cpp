@@ -0,0 +1,48 @@
+// Local Headers
+#include "package.hpp"
+
+// Standard Headers
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Cooks Loose Assets into a Package:
+//
+//     pack <output> [--compress | --blocks] <files...>
+//
+// Entries are Named by their Path Relative to PROJECT_SOURCE_DIR, Which is
+// How Mesh, Shader and TextureArrays Look Them Up Once it is Mounted. Use
+// --blocks for Large Cooked Payloads that a Streamer Decompresses in Parallel.
+int main(int argc, char * argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s <output> [--compress | --blocks] <files...>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Mirage::PackageWriter writer;
+    std::uint32_t flags = 0;
+    std::size_t original = 0, count = 0;
+    for (int i = 2; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--compress") == 0) { flags = Mirage::Package::EntryCompressed; continue; }
+        if (std::strcmp(argv[i], "--blocks")   == 0) { flags = Mirage::Package::EntryBlocks;     continue; }
+        std::ifstream fd(argv[i], std::ios::binary);
+        if (fd.is_open() == false) { fprintf(stderr, "Failed to Read %s\n", argv[i]); return EXIT_FAILURE; }
+        std::vector<char> data((std::istreambuf_iterator<char>(fd)), std::istreambuf_iterator<char>());
+        writer.add(argv[i], data.data(), data.size(), flags);
+        original += data.size(); count++;
+    }
+
+    if (writer.write(argv[1]) == false) return EXIT_FAILURE;
+    std::ifstream written(argv[1], std::ios::binary | std::ios::ate);
+    fprintf(stderr, "Packed %zu Files, %zu Bytes into %lld Bytes\n",
+            count, original, (long long) written.tellg());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,330 @@
+// Local Headers
+#include "package.hpp"
+#include "jobs.hpp"
+
+// System Headers
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <lz4.h>
+
+// Standard Headers
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+// Define Namespace
+namespace Mirage
+{
+    static Package * sMounted = nullptr;
+
+    // The LZ4 Block API Takes int Sizes; Larger Entries are Stored as They Are
+    static std::size_t bound(std::size_t size)
+    {
+        return size > LZ4_MAX_INPUT_SIZE ? 0 : std::size_t(LZ4_compressBound(int(size)));
+    }
+
+    static std::size_t compress(unsigned char const * source, std::size_t size,
+                                unsigned char * destination, std::size_t capacity)
+    {
+        if (size > LZ4_MAX_INPUT_SIZE) return 0;
+        int packed = LZ4_compress_default(reinterpret_cast<char const *>(source),
+                                          reinterpret_cast<char *>(destination),
+                                          int(size), int(std::min<std::size_t>(capacity, INT_MAX)));
+        return packed > 0 ? std::size_t(packed) : 0;
+    }
+
+    static bool decompress(unsigned char const * source, std::size_t size,
+                           unsigned char * destination, std::size_t original)
+    {
+        // Safe Decoding Never Reads or Writes Past Either Buffer
+        if (size > INT_MAX || original > INT_MAX) return false;
+        return LZ4_decompress_safe(reinterpret_cast<char const *>(source),
+                                   reinterpret_cast<char *>(destination),
+                                   int(size), int(original)) == int(original);
+    }
+
+    Package::Package(std::string const & filename)
+    {
+        // Map the Whole File; Pages Fault in Sequentially as Loaders Walk It
+#if defined(_WIN32)
+        mFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (mFile == INVALID_HANDLE_VALUE) { mFile = nullptr; return; }
+        LARGE_INTEGER size; GetFileSizeEx(mFile, & size);
+        mSize = std::size_t(size.QuadPart);
+        mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mMapping) mBase = static_cast<unsigned char const *>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd == -1) { fprintf(stderr, "Failed to Open Package %s\n", filename.c_str()); return; }
+        struct stat info;
+        if (fstat(fd, & info) == 0 && info.st_size > 0)
+        {
+            mSize = std::size_t(info.st_size);
+            void * base = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (base != MAP_FAILED)
+            {
+                madvise(base, mSize, MADV_SEQUENTIAL);
+                mBase = static_cast<unsigned char const *>(base);
+            }
+        }   close(fd);
+#endif
+        if (mBase == nullptr) return;
+
+        // Check the Header and that the Table Fits
+        Header header;
+        if (mSize >= sizeof(header)) std::memcpy(& header, mBase, sizeof(header));
+        if (mSize < sizeof(header) || header.magic != kMagic || header.version != kVersion ||
+            header.slots == 0 || (header.slots & (header.slots - 1)) != 0 ||
+            sizeof(header) + std::size_t(header.slots) * sizeof(Entry) > mSize)
+        {
+            fprintf(stderr, "Invalid Package %s\n", filename.c_str());
+            unmap();
+            return;
+        }
+        mEntries = reinterpret_cast<Entry const *>(mBase + sizeof(header));
+        mSlots = header.slots;
+    }
+
+    Package::~Package()
+    {
+        if (sMounted == this) sMounted = nullptr;
+        unmap();
+    }
+
+    void Package::unmap()
+    {
+#if defined(_WIN32)
+        if (mBase) UnmapViewOfFile(mBase);
+        if (mMapping) CloseHandle(mMapping);
+        if (mFile) CloseHandle(mFile);
+        mMapping = mFile = nullptr;
+#else
+        if (mBase) munmap(const_cast<unsigned char *>(mBase), mSize);
+#endif
+        mBase = nullptr;
+        mEntries = nullptr;
+    }
+
+    Package::Entry const * Package::find(std::string const & name) const
+    {
+        if (mEntries == nullptr) return nullptr;
+        std::uint64_t key = hash(name);
+        for (std::uint32_t i = 0; i < mSlots; i++)
+        {
+            // Probe Linearly Until the Key or an Empty Slot Turns Up
+            auto const & entry = mEntries[(key + i) & (mSlots - 1)];
+            if (entry.hash == 0) return nullptr;
+            if (entry.hash != key) continue;
+            if (entry.offset > mSize || entry.size > mSize - entry.offset) return nullptr;
+            return & entry;
+        }   return nullptr;
+    }
+
+    bool Package::read(std::string const & name, Span & span, std::vector<unsigned char> & scratch) const
+    {
+        auto entry = find(name);
+        if (entry == nullptr) return false;
+        span = raw(* entry);
+        if ((entry->flags & (EntryCompressed | EntryBlocks)) == 0) return true;
+
+        // Compressed Entries are the Only Ones that Need a Copy
+        scratch.resize(std::size_t(entry->original));
+        if (decode(* entry, scratch.data()) == false)
+        {
+            fprintf(stderr, "Corrupt Package Entry %s\n", name.c_str());
+            return false;
+        }
+        span = Span { scratch.data(), scratch.size() };
+        return true;
+    }
+
+    bool Package::decode(Entry const & entry, void * destination, Scheduler * scheduler) const
+    {
+        Span span = raw(entry);
+        auto output = static_cast<unsigned char *>(destination);
+        std::size_t original = std::size_t(entry.original);
+        if (entry.flags & EntryCompressed) return decompress(span.data, span.size, output, original);
+        if ((entry.flags & EntryBlocks) == 0)
+        {
+            if (span.size != original) return false;
+            std::memcpy(output, span.data, original);
+            return true;
+        }
+
+        // Read the Block Table and Turn Stored Sizes into Offsets
+        std::uint32_t header[2];
+        if (span.size < sizeof(header)) return false;
+        std::memcpy(header, span.data, sizeof(header));
+        std::size_t size = header[0], count = header[1];
+        if (size == 0 || count != (original + size - 1) / size ||
+            (span.size - sizeof(header)) / sizeof(std::uint32_t) < count) return false;
+        std::vector<std::size_t> offsets(count + 1, sizeof(header) + count * sizeof(std::uint32_t));
+        for (std::size_t i = 0; i < count; i++)
+        {
+            std::uint32_t stored;
+            std::memcpy(& stored, span.data + sizeof(header) + i * sizeof(stored), sizeof(stored));
+            offsets[i + 1] = offsets[i] + stored;
+        }   if (offsets[count] > span.size) return false;
+
+        // Blocks Don't Depend on Each Other, so Each Job Takes a Few
+        std::atomic<bool> failed(false);
+        auto blocks = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                std::size_t length = std::min(size, original - i * size);
+                std::size_t stored = offsets[i + 1] - offsets[i];
+                unsigned char const * from = span.data + offsets[i];
+                if (stored == length) std::memcpy(output + i * size, from, length);
+                else if (decompress(from, stored, output + i * size, length) == false) failed = true;
+            }
+        };
+        if (scheduler) scheduler->parallel_for(count, 1, blocks);
+        else blocks(0, count);
+        return failed == false;
+    }
+
+    std::uint64_t Package::hash(std::string const & name)
+    {
+        // FNV-1a over the Normalized Path; Zero Marks an Empty Slot
+        std::string path = normalize(name);
+        std::uint64_t hash = 14695981039346656037ull;
+        for (auto i : path) hash = (hash ^ static_cast<unsigned char>(i)) * 1099511628211ull;
+        return hash ? hash : 1;
+    }
+
+    std::string Package::normalize(std::string const & path)
+    {
+        // Strip the Source Directory, Unify Separators, and Resolve . and ..
+        std::string name = path, root = PROJECT_SOURCE_DIR "/";
+        for (auto &i : name) if (i == '\\') i = '/';
+        if (name.compare(0, root.size(), root) == 0) name.erase(0, root.size());
+
+        std::vector<std::string> parts;
+        std::size_t begin = 0;
+        while (begin <= name.size())
+        {
+            std::size_t end = name.find('/', begin);
+            if (end == std::string::npos) end = name.size();
+            std::string part = name.substr(begin, end - begin);
+            if (part == "..") { if (!parts.empty()) parts.pop_back(); }
+            else if (!part.empty() && part != ".") parts.push_back(part);
+            begin = end + 1;
+        }
+
+        std::string normalized;
+        for (auto &i : parts) normalized += (normalized.empty() ? "" : "/") + i;
+        return normalized;
+    }
+
+    void      Package::mount(Package * package) { sMounted = package; }
+    Package * Package::mounted() { return sMounted; }
+
+    bool Package::lookup(std::string const & path, Span & span, std::vector<unsigned char> & scratch)
+    {
+        return sMounted && sMounted->read(path, span, scratch);
+    }
+
+    void PackageWriter::add(std::string const & name, void const * data, std::size_t size, std::uint32_t flags)
+    {
+        Pending pending;
+        pending.name = Package::normalize(name);
+        pending.entry = Package::Entry { Package::hash(name), 0, size, size, 0, 0 };
+        auto bytes = static_cast<unsigned char const *>(data);
+
+        if ((flags & Package::EntryBlocks) && size > 0)
+        {
+            // Block Table First, then Each Block, Compressed Only if it Shrinks
+            std::uint32_t count = std::uint32_t((size + Package::kBlockSize - 1) / Package::kBlockSize);
+            std::uint32_t header[2] = { Package::kBlockSize, count };
+            std::vector<std::uint32_t> sizes(count);
+            std::vector<unsigned char> blocks, packed(bound(Package::kBlockSize));
+            for (std::uint32_t i = 0; i < count; i++)
+            {
+                std::size_t length = std::min<std::size_t>(Package::kBlockSize, size - std::size_t(i) * Package::kBlockSize);
+                unsigned char const * block = bytes + std::size_t(i) * Package::kBlockSize;
+                std::size_t stored = compress(block, length, packed.data(), packed.size());
+                if (stored > 0 && stored < length) blocks.insert(blocks.end(), packed.begin(), packed.begin() + stored);
+                else blocks.insert(blocks.end(), block, block + length), stored = length;
+                sizes[i] = std::uint32_t(stored);
+            }
+
+            auto table = reinterpret_cast<unsigned char const *>(sizes.data());
+            pending.data.assign(reinterpret_cast<unsigned char const *>(header),
+                                reinterpret_cast<unsigned char const *>(header) + sizeof(header));
+            pending.data.insert(pending.data.end(), table, table + sizes.size() * sizeof(std::uint32_t));
+            pending.data.insert(pending.data.end(), blocks.begin(), blocks.end());
+            pending.entry.size = pending.data.size();
+            pending.entry.flags |= Package::EntryBlocks;
+        }
+
+        // Keep the Compressed Form Only When it Actually Saves Space
+        else if ((flags & Package::EntryCompressed) && size > 0)
+        {
+            pending.data.resize(bound(size));
+            std::size_t packed = compress(bytes, size, pending.data.data(), pending.data.size());
+            if (packed > 0 && packed < size - size / 16)
+            {
+                pending.data.resize(packed);
+                pending.entry.size = packed;
+                pending.entry.flags |= Package::EntryCompressed;
+            }
+            else pending.data.clear();
+        }
+        if (pending.data.empty()) pending.data.assign(bytes, bytes + size);
+        mPending.push_back(std::move(pending));
+    }
+
+    bool PackageWriter::write(std::string const & filename) const
+    {
+        // Keep the Table at Most Half Full so Probes Stay Short
+        std::uint32_t slots = 2;
+        while (slots < mPending.size() * 2) slots *= 2;
+        std::vector<Package::Entry> table(slots, Package::Entry { 0, 0, 0, 0, 0, 0 });
+
+        std::uint64_t offset = sizeof(Package::Header) + slots * sizeof(Package::Entry);
+        for (auto &i : mPending)
+        {
+            offset = (offset + Package::kAlignment - 1) / Package::kAlignment * Package::kAlignment;
+            Package::Entry entry = i.entry;
+            entry.offset = offset;
+            offset += entry.size;
+
+            std::uint32_t slot = std::uint32_t(entry.hash & (slots - 1));
+            while (table[slot].hash != 0)
+            {
+                if (table[slot].hash == entry.hash)
+                {
+                    fprintf(stderr, "Duplicate or Colliding Package Entry %s\n", i.name.c_str());
+                    return false;
+                }   slot = (slot + 1) & (slots - 1);
+            }   table[slot] = entry;
+        }
+
+        std::ofstream fd(filename, std::ios::binary);
+        if (fd.is_open() == false) { fprintf(stderr, "Failed to Write Package %s\n", filename.c_str()); return false; }
+        Package::Header header = { Package::kMagic, Package::kVersion, std::uint32_t(mPending.size()), slots };
+        fd.write(reinterpret_cast<char const *>(& header), sizeof(header));
+        fd.write(reinterpret_cast<char const *>(table.data()), table.size() * sizeof(Package::Entry));
+
+        // Pad Up to Each Entry's Aligned Offset
+        std::uint64_t position = sizeof(header) + table.size() * sizeof(Package::Entry);
+        char const padding[Package::kAlignment] = {};
+        for (auto &i : mPending)
+        {
+            std::uint64_t aligned = (position + Package::kAlignment - 1) / Package::kAlignment * Package::kAlignment;
+            fd.write(padding, std::streamsize(aligned - position));
+            fd.write(reinterpret_cast<char const *>(i.data.data()), std::streamsize(i.data.size()));
+            position = aligned + i.data.size();
+        }   return bool(fd);
+    }
+};
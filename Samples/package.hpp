@@ -0,0 +1,122 @@
+#pragma once
+
+// Standard Headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    class Scheduler;
+
+    // Bytes Owned by Someone Else, Usually the Package Mapping
+    struct Span {
+        unsigned char const * data;
+        std::size_t size;
+    };
+
+    // Read-Only Archive Mapped into Memory with a Single mmap. A Header is
+    // Followed by an Open-Addressed Table of Entries Keyed by a Hash of Each
+    // Path, then the Entry Data, Each Aligned to kAlignment. Uncompressed
+    // Entries are Handed Out as Spans Straight into the Mapping. Block Entries
+    // are Split into kBlockSize Pieces Compressed on their Own, so they Can be
+    // Decompressed in Parallel; they Start with the Block Size, the Block
+    // Count, and Each Block's Stored Size, and a Block Stored at Full Length
+    // was Left Uncompressed.
+    class Package
+    {
+    public:
+
+        static const std::uint32_t kMagic = 0x4B41504D; // "MPAK"
+        static const std::uint32_t kVersion = 1;
+        static const std::uint32_t kAlignment = 64;
+        static const std::uint32_t kBlockSize = 1 << 16;
+
+        enum EntryFlags : std::uint32_t {
+            EntryCompressed = 1 << 0,
+            EntryBlocks     = 1 << 1,
+        };
+
+        struct Header {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t count;
+            std::uint32_t slots;
+        };
+
+        // Unused Slots Have a Hash of Zero
+        struct Entry {
+            std::uint64_t hash;
+            std::uint64_t offset;
+            std::uint64_t size;
+            std::uint64_t original;
+            std::uint32_t flags;
+            std::uint32_t reserved;
+        };
+
+        // Implement Custom Constructor and Destructor
+        explicit Package(std::string const & filename);
+        ~Package();
+
+        // Public Member Functions
+        bool          valid() const { return mBase != nullptr; }
+        Entry const * find(std::string const & name) const;
+        Span          raw(Entry const & entry) const { return Span { mBase + entry.offset, std::size_t(entry.size) }; }
+        bool          read(std::string const & name, Span & span, std::vector<unsigned char> & scratch) const;
+        bool          decode(Entry const & entry, void * destination, Scheduler * scheduler = nullptr) const;
+
+        // Paths are Normalized and Relative to PROJECT_SOURCE_DIR Before Hashing
+        static std::uint64_t hash(std::string const & name);
+        static std::string   normalize(std::string const & path);
+
+        // Loaders Check the Mounted Package First, then Fall Back to Disk
+        static void      mount(Package * package);
+        static Package * mounted();
+        static bool      lookup(std::string const & path, Span & span, std::vector<unsigned char> & scratch);
+
+    private:
+
+        // Disable Copying and Assignment
+        Package(Package const &) = delete;
+        Package & operator=(Package const &) = delete;
+
+        // Private Member Functions
+        void unmap();
+
+        // Private Member Variables
+        unsigned char const * mBase = nullptr;
+        Entry const * mEntries = nullptr;
+        std::size_t   mSize = 0;
+        std::uint32_t mSlots = 0;
+#if defined(_WIN32)
+        void * mFile = nullptr;
+        void * mMapping = nullptr;
+#endif
+
+    };
+
+    // Builds a Package; Used by the Cooking Tool, Not at Runtime
+    class PackageWriter
+    {
+    public:
+
+        // Public Member Functions
+        void add(std::string const & name, void const * data, std::size_t size, std::uint32_t flags = 0);
+        bool write(std::string const & filename) const;
+
+    private:
+
+        // Entry Data Waiting to be Written
+        struct Pending {
+            std::string name;
+            Package::Entry entry;
+            std::vector<unsigned char> data;
+        };
+
+        // Private Member Containers
+        std::vector<Pending> mPending;
+
+    };
+};
@@ -0,0 +1,244 @@
+// Local Headers
+#include "package.hpp"
+#include "permutation.hpp"
+#include "shader.hpp"
+
+// System Headers
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#endif
+
+// Standard Headers
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+// Define Namespace
+namespace Mirage
+{
+    // FNV-1a, Used to Name Cached Binaries
+    static std::uint64_t hash(void const * data, std::size_t size, std::uint64_t seed = 14695981039346656037ull)
+    {
+        auto bytes = static_cast<unsigned char const *>(data);
+        for (std::size_t i = 0; i < size; i++) seed = (seed ^ bytes[i]) * 1099511628211ull;
+        return seed;
+    }
+
+    Permutations::Permutations(GLFWwindow * window, std::vector<std::string> const & filenames,
+                               std::string const & cache, unsigned int contexts)
+        : mCache(cache), mCached(0)
+    {
+        // Binaries Only Match the Driver that Built Them, so Hash it In
+        std::string signature = reinterpret_cast<char const *>(glGetString(GL_RENDERER));
+        signature += reinterpret_cast<char const *>(glGetString(GL_VERSION));
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, & formats);
+        mBinaries = formats > 0;
+#if !defined(_WIN32)
+        mkdir(mCache.c_str(), 0755);
+#endif
+
+        for (auto &i : filenames)
+        {
+            // Load GLSL Shader Source from the Mounted Package, or Else from File
+            std::string path = kShaderDirectory;
+            Span span; std::vector<unsigned char> scratch;
+            std::stringstream fd;
+            if (Package::lookup(path + i, span, scratch))
+                fd.write(reinterpret_cast<char const *>(span.data), span.size);
+            else fd << std::ifstream(path + i).rdbuf();
+            std::string line;
+            Source source = { i, "", "" };
+            while (std::getline(fd, line))
+            {
+                // Collect Keywords; the #version Line Must Stay First
+                std::istringstream tokens(line);
+                std::string directive, pragma, keyword;
+                tokens >> directive;
+                if (directive == "#version") { source.version = line + "\n"; continue; }
+                if (directive == "#pragma" && (tokens >> pragma) && pragma == "keywords")
+                {
+                    while (tokens >> keyword)
+                        if (std::find(mKeywords.begin(), mKeywords.end(), keyword) == mKeywords.end())
+                            mKeywords.push_back(keyword);
+                    line.clear();
+                }
+                source.body += line + "\n";
+            }
+            signature += source.version + source.body;
+            mSources.push_back(source);
+        }
+
+        if (mKeywords.size() > 64) fprintf(stderr, "Too Many Shader Keywords: %zu\n", mKeywords.size());
+        mSignature = hash(signature.data(), signature.size());
+
+        // Hidden Windows Whose Contexts Share Objects with the Main One
+        glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+        for (unsigned int i = 0; i < contexts; i++)
+        {
+            auto context = glfwCreateWindow(1, 1, "Permutations", nullptr, window);
+            if (context) mContexts.push_back(context);
+        }   glfwWindowHint(GLFW_VISIBLE, GL_TRUE);
+    }
+
+    Permutations::~Permutations()
+    {
+        for (auto &i : mPrograms) glDeleteProgram(i.second);
+        for (auto &i : mContexts) glfwDestroyWindow(i);
+    }
+
+    std::uint64_t Permutations::key(std::vector<std::string> const & keywords) const
+    {
+        std::uint64_t key = 0;
+        for (auto &i : keywords)
+        {
+            auto found = std::find(mKeywords.begin(), mKeywords.end(), i);
+            if (found == mKeywords.end()) fprintf(stderr, "Unknown Shader Keyword: %s\n", i.c_str());
+            else key |= std::uint64_t(1) << (found - mKeywords.begin());
+        }   return key;
+    }
+
+    void Permutations::compile(std::vector<std::uint64_t> const & keys)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<GLuint> programs(keys.size(), 0);
+        std::atomic<std::size_t> next(0);
+        mCached = 0;
+
+        // Each Thread Pulls Keys Until None are Left
+        auto worker = [&](GLFWwindow * context) {
+            glfwMakeContextCurrent(context);
+            for (std::size_t i; (i = next++) < keys.size();) programs[i] = build(keys[i]);
+
+            // Finish so the Programs are Complete Before Another Context Uses Them
+            glFinish();
+            glfwMakeContextCurrent(nullptr);
+        };
+
+        if (mContexts.empty())
+            for (std::size_t i = 0; i < keys.size(); i++) programs[i] = build(keys[i]);
+        else
+        {
+            std::vector<std::thread> threads;
+            for (auto &i : mContexts) threads.emplace_back(worker, i);
+            for (auto &i : threads) i.join();
+        }
+
+        for (std::size_t i = 0; i < keys.size(); i++)
+        {
+            if (programs[i] == 0) continue;
+            auto & program = mPrograms[keys[i]];
+            if (program) glDeleteProgram(program);
+            program = programs[i];
+        }
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+        fprintf(stderr, "Built %zu Permutations (%u Cached) in %.1f ms\n",
+                keys.size(), mCached.load(), elapsed.count());
+    }
+
+    GLuint Permutations::get(std::uint64_t key)
+    {
+        // Variants Missing from compile() Still Work, but Stall the Caller
+        auto found = mPrograms.find(key);
+        if (found != mPrograms.end()) return found->second;
+        fprintf(stderr, "Building Permutation %llx on Demand\n", (unsigned long long) key);
+        return mPrograms[key] = build(key);
+    }
+
+    GLuint Permutations::build(std::uint64_t key)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long) hash(& key, sizeof(key), mSignature));
+        std::string path = mCache + name;
+        if (mBinaries)
+        {
+            GLuint program = load(path);
+            if (program) { mCached++; return program; }
+        }
+
+        // Prepend a Define for Every Keyword Set in the Key
+        std::string defines;
+        for (std::size_t i = 0; i < mKeywords.size() && i < 64; i++)
+            if (key & (std::uint64_t(1) << i)) defines += "#define " + mKeywords[i] + " 1\n";
+
+        GLuint program = glCreateProgram();
+        for (auto &i : mSources)
+        {
+            char const * strings[] = { i.version.c_str(), defines.c_str(), i.body.c_str() };
+            GLuint shader = Shader::create(i.filename);
+            glShaderSource(shader, 3, strings, nullptr);
+            glCompileShader(shader);
+            glAttachShader(program, shader);
+
+            // Display the Compile Log on Error; Linking Will Fail Below
+            GLint status, length;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, & status);
+            if (status == GL_FALSE)
+            {
+                glGetShaderiv(shader, GL_INFO_LOG_LENGTH, & length);
+                std::unique_ptr<char[]> buffer(new char[length + 1]());
+                glGetShaderInfoLog(shader, length, nullptr, buffer.get());
+                fprintf(stderr, "%s\n%s", i.filename.c_str(), buffer.get());
+            }   glDeleteShader(shader);
+        }
+
+        if (mBinaries) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glLinkProgram(program);
+        if (linked(program, name) == false) { glDeleteProgram(program); return 0; }
+        if (mBinaries) save(path, program);
+        return program;
+    }
+
+    GLuint Permutations::load(std::string const & path)
+    {
+        // Cached Files Hold the Binary Format Followed by the Binary
+        std::ifstream fd(path, std::ios::binary);
+        if (fd.is_open() == false) return 0;
+        GLenum format;
+        fd.read(reinterpret_cast<char *>(& format), sizeof(format));
+        std::string binary(std::istreambuf_iterator<char>(fd), (std::istreambuf_iterator<char>()));
+        if (fd.bad() || binary.empty()) return 0;
+
+        // Drivers May Reject Old Binaries; Fall Back to Compiling Quietly
+        GLuint program = glCreateProgram();
+        glProgramBinary(program, format, binary.data(), GLsizei(binary.size()));
+        GLint status;
+        glGetProgramiv(program, GL_LINK_STATUS, & status);
+        if (status == GL_TRUE) return program;
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    void Permutations::save(std::string const & path, GLuint program)
+    {
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, & length);
+        if (length == 0) return;
+        std::unique_ptr<char[]> binary(new char[length]);
+        GLenum format;
+        glGetProgramBinary(program, length, nullptr, & format, binary.get());
+
+        std::ofstream fd(path, std::ios::binary);
+        fd.write(reinterpret_cast<char const *>(& format), sizeof(format));
+        fd.write(binary.get(), length);
+    }
+
+    bool Permutations::linked(GLuint program, char const * name) const
+    {
+        GLint status, length;
+        glGetProgramiv(program, GL_LINK_STATUS, & status);
+        if (status == GL_TRUE) return true;
+
+        // Display the Build Log on Error
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, & length);
+        std::unique_ptr<char[]> buffer(new char[length + 1]());
+        glGetProgramInfoLog(program, length, nullptr, buffer.get());
+        fprintf(stderr, "Permutation %s\n%s", name, buffer.get());
+        return false;
+    }
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+// System Headers
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Standard Headers
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Builds Variants of One Program from a Single Set of Sources. Sources
+    // Declare their Feature Keywords on a Line Such as
+    //
+    //     #pragma keywords SKINNED NORMAL_MAP ALPHA_TEST
+    //
+    // and Each Keyword Becomes a Bit in a 64-Bit Key; a Variant is Built by
+    // Prepending "#define KEYWORD 1" for Every Bit Set. compile() Builds a
+    // List of Keys Up Front Across Several Shared Contexts, Loading Program
+    // Binaries Cached on Disk by Earlier Runs Where Possible.
+    class Permutations
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor; Call from the Main Thread
+         Permutations(GLFWwindow * window, std::vector<std::string> const & filenames,
+                      std::string const & cache = PROJECT_SOURCE_DIR "/Build/ShaderCache/",
+                      unsigned int contexts = 4);
+        ~Permutations();
+
+        // Public Member Functions
+        std::uint64_t key(std::vector<std::string> const & keywords) const;
+        void   compile(std::vector<std::uint64_t> const & keys);
+        GLuint get(std::uint64_t key);
+        std::vector<std::string> const & keywords() const { return mKeywords; }
+
+    private:
+
+        // Disable Copying and Assignment
+        Permutations(Permutations const &) = delete;
+        Permutations & operator=(Permutations const &) = delete;
+
+        // Source Split Around the Point Where Defines are Inserted
+        struct Source {
+            std::string filename;
+            std::string version;
+            std::string body;
+        };
+
+        // Private Member Functions
+        GLuint build(std::uint64_t key);
+        GLuint load(std::string const & path);
+        void   save(std::string const & path, GLuint program);
+        bool   linked(GLuint program, char const * name) const;
+
+        // Private Member Containers
+        std::vector<Source> mSources;
+        std::vector<std::string> mKeywords;
+        std::vector<GLFWwindow *> mContexts;
+        std::unordered_map<std::uint64_t, GLuint> mPrograms;
+
+        // Private Member Variables
+        std::string   mCache;
+        std::uint64_t mSignature;
+        std::atomic<unsigned int> mCached;
+        bool          mBinaries = false;
+
+    };
+};
@@ -0,0 +1,133 @@
+// Local Headers
+#include "physics.hpp"
+
+// Standard Headers
+#include <algorithm>
+#include <numeric>
+
+// Define Namespace
+namespace Mirage
+{
+    // Pairs per Job for Bullet's Parallel Narrowphase
+    static const int kDispatchGrain = 40;
+
+    TaskScheduler::TaskScheduler(Scheduler & scheduler)
+        : btITaskScheduler("Mirage")
+        , mScheduler(scheduler)
+        , mThreads(int(scheduler.size()))
+    {
+        // Bullet Looks Up the Active Scheduler Globally; Worlds Built from Now On Use this One
+        btSetTaskScheduler(this);
+    }
+
+    TaskScheduler::~TaskScheduler()
+    {
+        if (btGetTaskScheduler() == this) btSetTaskScheduler(btGetSequentialTaskScheduler());
+    }
+
+    void TaskScheduler::setNumThreads(int threads)
+    {
+        mThreads = std::max(1, std::min(threads, getMaxNumThreads()));
+    }
+
+    std::size_t TaskScheduler::grain(int count, int grain) const
+    {
+        // With Every Thread in Play, Keep Bullet's Grain so Stealing Balances Load
+        std::size_t size = std::size_t(std::max(grain, 1));
+        if (mThreads >= getMaxNumThreads()) return size;
+        return std::max(size, std::size_t((count + mThreads - 1) / mThreads));
+    }
+
+    void TaskScheduler::parallelFor(int begin, int end, int grain, btIParallelForBody const & body)
+    {
+        int count = end - begin;
+        if (count <= 0) return;
+        std::size_t size = this->grain(count, grain);
+        if (mThreads == 1 || std::size_t(count) <= size) { body.forLoop(begin, end); return; }
+        mScheduler.parallel_for(std::size_t(count), size, [begin, & body](std::size_t first, std::size_t last) {
+            body.forLoop(begin + int(first), begin + int(last));
+        });
+    }
+
+    btScalar TaskScheduler::parallelSum(int begin, int end, int grain, btIParallelSumBody const & body)
+    {
+        // One Partial Sum per Range, Added in Order so Results Don't Depend on Timing
+        int count = end - begin;
+        if (count <= 0) return btScalar(0);
+        std::size_t size = this->grain(count, grain);
+        if (mThreads == 1 || std::size_t(count) <= size) return body.sumLoop(begin, end);
+        std::vector<btScalar> sums((count + size - 1) / size, btScalar(0));
+        mScheduler.parallel_for(sums.size(), 1, [begin, end, size, & sums, & body](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; i++)
+                sums[i] = body.sumLoop(begin + int(i * size), std::min(end, begin + int((i + 1) * size)));
+        });
+        return std::accumulate(sums.begin(), sums.end(), btScalar(0));
+    }
+
+    Physics::Physics(TaskScheduler & tasks, btVector3 const & gravity, Broadphase broadphase)
+        : mTasks(tasks)
+    {
+        // Preallocate Enough Pooled Manifolds that Workers Rarely Fall Back to the Heap
+        btDefaultCollisionConstructionInfo info;
+        info.m_defaultMaxPersistentManifoldPoolSize = 80000;
+        info.m_defaultMaxCollisionAlgorithmPoolSize = 80000;
+        mConfiguration.reset(new btDefaultCollisionConfiguration(info));
+        mDispatcher.reset(new btCollisionDispatcherMt(mConfiguration.get(), kDispatchGrain));
+        mBroadphase = Physics::broadphase(broadphase);
+
+        // One Solver per Thread Solves Islands Concurrently; the Mt Solver Handles Large Islands
+        mSolvers.reset(new btConstraintSolverPoolMt(mTasks.getMaxNumThreads()));
+        mSolver.reset(new btSequentialImpulseConstraintSolverMt());
+        mWorld.reset(new btDiscreteDynamicsWorldMt(mDispatcher.get(), mBroadphase.get(), mSolvers.get(),
+                                                   mSolver.get(), mConfiguration.get()));
+        mWorld->setGravity(gravity);
+    }
+
+    Physics::~Physics()
+    {
+        for (auto &i : mBodies) mWorld->removeRigidBody(i.get());
+        mWorld.reset();
+    }
+
+    std::unique_ptr<btBroadphaseInterface> Physics::broadphase(Broadphase type, btScalar extent)
+    {
+        btVector3 lower(-extent, -extent, -extent), upper(extent, extent, extent);
+        switch (type)
+        {
+            case AxisSweepBroadphase:    return std::unique_ptr<btBroadphaseInterface>(new btAxisSweep3(lower, upper));
+            case AxisSweep32Broadphase:  return std::unique_ptr<btBroadphaseInterface>(new bt32BitAxisSweep3(lower, upper));
+            case SortAndSweepBroadphase: return std::unique_ptr<btBroadphaseInterface>(new SortAndSweep());
+            default:                     return std::unique_ptr<btBroadphaseInterface>(new btDbvtBroadphase());
+        }
+    }
+
+    btRigidBody * Physics::add(btCollisionShape * shape, btScalar mass, btTransform const & transform,
+                               btMotionState * state)
+    {
+        // Zero Mass Makes a Static Body
+        btVector3 inertia(0.0f, 0.0f, 0.0f);
+        if (mass > 0.0f) shape->calculateLocalInertia(mass, inertia);
+        // Without a Caller's Motion State, Own a Default One; Null Entries Keep Indices Aligned
+        mMotionStates.push_back(std::unique_ptr<btMotionState>(state ? nullptr : new btDefaultMotionState(transform)));
+        btRigidBody::btRigidBodyConstructionInfo info(mass, state ? state : mMotionStates.back().get(), shape, inertia);
+        mBodies.push_back(std::unique_ptr<btRigidBody>(new btRigidBody(info)));
+        mWorld->addRigidBody(mBodies.back().get());
+        return mBodies.back().get();
+    }
+
+    void Physics::remove(btRigidBody * body)
+    {
+        auto found = std::find_if(mBodies.begin(), mBodies.end(),
+                                  [body](std::unique_ptr<btRigidBody> const & i) { return i.get() == body; });
+        if (found == mBodies.end()) return;
+        std::size_t index = found - mBodies.begin();
+        mWorld->removeRigidBody(body);
+        mBodies.erase(found);
+        mMotionStates.erase(mMotionStates.begin() + index);
+    }
+
+    void Physics::step(float dt)
+    {
+        mWorld->stepSimulation(dt, kSubSteps, btScalar(1.0f / 60.0f));
+    }
+};
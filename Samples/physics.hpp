@@ -0,0 +1,113 @@
+#pragma once
+
+// Local Headers
+#include "jobs.hpp"
+#include "sweep.hpp"
+
+// System Headers
+#include <btBulletDynamicsCommon.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <LinearMath/btThreads.h>
+
+// Standard Headers
+#include <memory>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Runs Bullet's Parallel Loops on a Mirage::Scheduler Instead of Bullet's
+    // Own Thread Pool, so Physics Shares Workers with Everything Else. Fewer
+    // Threads than the Scheduler Has are Emulated by Never Splitting a Loop
+    // into More Ranges than that. Bullet's Scheduler is Process-Global, so the
+    // Application Owns One, Installed for its Lifetime, and Every World Shares it.
+    class TaskScheduler : public btITaskScheduler
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor
+        explicit TaskScheduler(Scheduler & scheduler);
+        ~TaskScheduler();
+
+        // Public Member Functions
+        int  getMaxNumThreads() const override { return int(mScheduler.size()); }
+        int  getNumThreads() const override { return mThreads; }
+        void setNumThreads(int threads) override;
+        void parallelFor(int begin, int end, int grain, btIParallelForBody const & body) override;
+        btScalar parallelSum(int begin, int end, int grain, btIParallelSumBody const & body) override;
+
+    private:
+
+        // Disable Copying and Assignment
+        TaskScheduler(TaskScheduler const &) = delete;
+        TaskScheduler & operator=(TaskScheduler const &) = delete;
+
+        // Private Member Functions
+        std::size_t grain(int count, int grain) const;
+
+        // Private Member Variables
+        Scheduler & mScheduler;
+        int mThreads;
+
+    };
+
+    // Broadphases a World Can be Built With; Compare them on a Workload
+    // with broadphase_benchmark.cpp. Axis Sweeps Need Bounds on the World.
+    enum Broadphase {
+        DbvtBroadphase,
+        AxisSweepBroadphase,
+        AxisSweep32Broadphase,
+        SortAndSweepBroadphase,
+    };
+
+    // Multithreaded Bullet World: Narrowphase Dispatch and Constraint Solving
+    // Both Run Across the Application's TaskScheduler, which Must Outlive
+    // the World. Rigid Bodies Added Here are Owned Here;
+    // Collision Shapes are Shared Between Bodies and Owned by the Caller, as
+    // are Motion States Passed to add() (Such as a Bridge::State).
+    class Physics
+    {
+    public:
+
+        // Substeps Run at a Fixed Rate Regardless of the Frame Time
+        static const int kSubSteps = 4;
+
+        // Implement Custom Constructor and Destructor
+         Physics(TaskScheduler & tasks, btVector3 const & gravity = btVector3(0.0f, -9.81f, 0.0f),
+                 Broadphase broadphase = DbvtBroadphase);
+        ~Physics();
+
+        // Public Member Functions
+        btRigidBody * add(btCollisionShape * shape, btScalar mass, btTransform const & transform,
+                          btMotionState * state = nullptr);
+        void remove(btRigidBody * body);
+        void step(float dt);
+        btDiscreteDynamicsWorld & world() { return * mWorld; }
+        TaskScheduler & tasks() { return mTasks; }
+
+        // Build a Broadphase; Axis Sweeps Span a Cube of +/- Extent
+        static std::unique_ptr<btBroadphaseInterface> broadphase(Broadphase type, btScalar extent = 1000.0f);
+
+    private:
+
+        // Disable Copying and Assignment
+        Physics(Physics const &) = delete;
+        Physics & operator=(Physics const &) = delete;
+
+        // Private Member Containers
+        std::vector<std::unique_ptr<btRigidBody>> mBodies;
+        std::vector<std::unique_ptr<btMotionState>> mMotionStates;
+
+        // Private Member Variables
+        TaskScheduler & mTasks;
+        std::unique_ptr<btCollisionConfiguration> mConfiguration;
+        std::unique_ptr<btCollisionDispatcher> mDispatcher;
+        std::unique_ptr<btBroadphaseInterface> mBroadphase;
+        std::unique_ptr<btConstraintSolverPoolMt> mSolvers;
+        std::unique_ptr<btConstraintSolver> mSolver;
+        std::unique_ptr<btDiscreteDynamicsWorld> mWorld;
+
+    };
+};
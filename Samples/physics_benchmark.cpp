@@ -0,0 +1,56 @@
+// Local Headers
+#include "physics.hpp"
+
+// Standard Headers
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+// Drops Columns of Boxes into a Pile and Times Mirage::Physics Steps with
+// One Thread, then Two, and so On Up to Every Thread in the Scheduler:
+//
+//     physics_benchmark [boxes] [steps]
+typedef std::chrono::high_resolution_clock Clock;
+
+int main(int argc, char * argv[])
+{
+    int boxes = (argc > 1) ? std::atoi(argv[1]) : 4000;
+    int steps = (argc > 2) ? std::atoi(argv[2]) : 120;
+    const int height = 10, settle = 30;
+    int side = int(std::ceil(std::sqrt(float(boxes) / height)));
+
+    Mirage::Scheduler scheduler;
+    Mirage::TaskScheduler tasks(scheduler);
+    btStaticPlaneShape ground(btVector3(0.0f, 1.0f, 0.0f), 0.0f);
+    btBoxShape box(btVector3(0.5f, 0.5f, 0.5f));
+    fprintf(stdout, "boxes: %d, steps: %d\n", boxes, steps);
+    fprintf(stdout, "\n%-8s %12s %10s\n", "threads", "step (ms)", "speedup");
+
+    double single = 0.0;
+    for (unsigned int threads = 1; threads <= scheduler.size(); threads++)
+    {
+        // Rebuild the Same Scene Each Time; Alternate Layers are Offset so Columns Topple
+        Mirage::Physics physics(tasks);
+        tasks.setNumThreads(int(threads));
+        physics.add(& ground, 0.0f, btTransform::getIdentity());
+        for (int i = 0; i < boxes; i++)
+        {
+            int layer = i / (side * side), x = i % side, z = (i / side) % side;
+            float offset = (layer % 2) * 0.3f;
+            btTransform transform(btQuaternion::getIdentity(),
+                                  btVector3(x * 1.1f + offset, 0.5f + layer * 1.05f, z * 1.1f + offset));
+            physics.add(& box, 1.0f, transform);
+        }
+
+        // Let the Pile Form Before Timing, so Contacts Dominate Like in a Real Scene
+        for (int i = 0; i < settle; i++) physics.world().stepSimulation(1.0f / 60.0f, 0);
+        auto start = Clock::now();
+        for (int i = 0; i < steps; i++) physics.world().stepSimulation(1.0f / 60.0f, 0);
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / steps;
+        if (threads == 1) single = ms;
+        fprintf(stdout, "%-8u %12.2f %9.2fx\n", threads, ms, single / ms);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+// System Headers
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Blocking Queue with a Fixed Capacity; close() Wakes Every Waiter
+    template<typename T> class Queue
+    {
+    public:
+
+        // Implement Custom Constructor
+        explicit Queue(std::size_t capacity) : mCapacity(capacity) {}
+
+        // Public Member Functions
+        bool push(T value)
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mNotFull.wait(lock, [this] { return mClosed || mItems.size() < mCapacity; });
+            if (mClosed) return false;
+            mItems.push_back(std::move(value));
+            mNotEmpty.notify_one();
+            return true;
+        }
+
+        bool pop(T & value)
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mNotEmpty.wait(lock, [this] { return mClosed || !mItems.empty(); });
+            if (mItems.empty()) return false;
+            value = std::move(mItems.front());
+            mItems.pop_front();
+            mNotFull.notify_one();
+            return true;
+        }
+
+        void close()
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mClosed = true;
+            mNotEmpty.notify_all();
+            mNotFull.notify_all();
+        }
+
+    private:
+
+        // Disable Copying and Assignment
+        Queue(Queue const &) = delete;
+        Queue & operator=(Queue const &) = delete;
+
+        // Private Member Variables
+        std::deque<T> mItems;
+        std::mutex mMutex;
+        std::condition_variable mNotEmpty;
+        std::condition_variable mNotFull;
+        std::size_t mCapacity;
+        bool mClosed = false;
+
+    };
+
+    // Latest Value Published by One Thread and Read by Another, Used to Hand
+    // Input Sampled Alongside glfwPollEvents() Over to the Simulation
+    template<typename T> class Mailbox
+    {
+    public:
+
+        // Public Member Functions
+        void publish(T const & value) { std::lock_guard<std::mutex> lock(mMutex); mValue = value; }
+        T    read()                   { std::lock_guard<std::mutex> lock(mMutex); return mValue; }
+
+    private:
+
+        // Private Member Variables
+        std::mutex mMutex;
+        T mValue = T();
+
+    };
+
+    // Everything the Render Thread Needs to Draw One Frame
+    struct FramePacket {
+        unsigned long frame;
+        double time;
+        glm::mat4 view;
+        glm::mat4 projection;
+        std::vector<glm::mat4> transforms;
+        std::vector<GLuint> visible;
+    };
+
+    // Runs a Simulation Thread One Frame Ahead of the Render Thread. Packets
+    // Circulate Between a Free Queue and a Ready Queue, so the Simulation
+    // Fills Frame N+1 While the Caller Draws Frame N, and Neither Side
+    // Allocates Once the Packets' Vectors Have Grown to their Working Size.
+    template<typename Packet = FramePacket> class Pipeline
+    {
+    public:
+
+        // Simulate Fills a Packet and Returns False to Stop the Pipeline
+        typedef std::function<bool(Packet &)> Simulate;
+
+        // Implement Custom Constructor and Destructor
+        explicit Pipeline(Simulate simulate, std::size_t depth = 2)
+            : mPackets(depth), mFree(depth), mReady(depth), mSimulate(simulate)
+        {
+            for (auto &i : mPackets) mFree.push(& i);
+            mThread = std::thread([this] { run(); });
+        }
+
+        ~Pipeline()
+        {
+            mFree.close();
+            mReady.close();
+            mThread.join();
+        }
+
+        // Block Until the Next Frame is Ready; Returns Null Once Stopped
+        Packet const * acquire()
+        {
+            Packet * packet = nullptr;
+            return mReady.pop(packet) ? packet : nullptr;
+        }
+
+        // Hand a Drawn Packet Back to the Simulation
+        void release(Packet const * packet) { mFree.push(const_cast<Packet *>(packet)); }
+
+    private:
+
+        // Disable Copying and Assignment
+        Pipeline(Pipeline const &) = delete;
+        Pipeline & operator=(Pipeline const &) = delete;
+
+        // Private Member Functions
+        void run()
+        {
+            Packet * packet = nullptr;
+            while (mFree.pop(packet))
+            {
+                if (!mSimulate(* packet)) break;
+                if (!mReady.push(packet)) break;
+            }   mReady.close();
+        }
+
+        // Private Member Containers
+        std::vector<Packet> mPackets;
+        Queue<Packet *> mFree;
+        Queue<Packet *> mReady;
+
+        // Private Member Variables
+        Simulate mSimulate;
+        std::thread mThread;
+
+    };
+};
@@ -0,0 +1,174 @@
+// Local Headers
+#include "query.hpp"
+
+// Define Namespace
+namespace Mirage
+{
+    Queries::Queries(Scheduler & scheduler, btCollisionWorld & world)
+        : mScheduler(scheduler), mWorld(world)
+    {}
+
+    void Queries::snapshot()
+    {
+        // Broadphase Proxies Already Hold Margin-Expanded Bounds; Copy Them Rather than Recomputing
+        mStamp++;
+        auto & objects = mWorld.getCollisionObjectArray();
+        for (int i = 0; i < objects.size(); i++)
+        {
+            btCollisionObject * object = objects[i];
+            btBroadphaseProxy * proxy = object->getBroadphaseHandle();
+            if (proxy == nullptr) continue;
+
+            auto found = mIndices.find(object);
+            if (found == mIndices.end())
+            {
+                Entry entry = { object, object->getCollisionShape(), object->getWorldTransform(),
+                                proxy->m_aabbMin, proxy->m_aabbMax, nullptr,
+                                proxy->m_collisionFilterGroup, proxy->m_collisionFilterMask, mStamp };
+                entry.leaf = mTree.insert(btDbvtVolume::FromMM(entry.lower, entry.upper), nullptr);
+                entry.leaf->dataAsInt = int(mEntries.size());
+                mIndices.insert(std::make_pair(object, mEntries.size()));
+                mEntries.push_back(entry);
+                continue;
+            }
+
+            // Refit Only Leaves Whose Bounds Changed; Sleeping and Static Objects Don't
+            Entry & entry = mEntries[found->second];
+            entry.shape = object->getCollisionShape();
+            entry.transform = object->getWorldTransform();
+            entry.group = proxy->m_collisionFilterGroup;
+            entry.mask = proxy->m_collisionFilterMask;
+            entry.stamp = mStamp;
+            if (entry.lower != proxy->m_aabbMin || entry.upper != proxy->m_aabbMax)
+            {
+                entry.lower = proxy->m_aabbMin;
+                entry.upper = proxy->m_aabbMax;
+                btDbvtVolume volume = btDbvtVolume::FromMM(entry.lower, entry.upper);
+                mTree.update(entry.leaf, volume);
+            }
+        }
+
+        // Drop Objects that Left the World, then Spend a Little Time Rebalancing
+        for (std::size_t i = mEntries.size(); i-- > 0;)
+            if (mEntries[i].stamp != mStamp) erase(i);
+        mTree.optimizeIncremental(1);
+    }
+
+    void Queries::erase(std::size_t index)
+    {
+        mTree.remove(mEntries[index].leaf);
+        mIndices.erase(mEntries[index].object);
+        if (index + 1 != mEntries.size())
+        {
+            mEntries[index] = mEntries.back();
+            mEntries[index].leaf->dataAsInt = int(index);
+            mIndices[mEntries[index].object] = index;
+        }   mEntries.pop_back();
+    }
+
+    void Queries::raycast(btVector3 const * from, btVector3 const * to, std::size_t count, Hits & hits,
+                          int group, int mask) const
+    {
+        // Narrowphase Against the Snapshot Transform of Each Leaf the Ray Reaches
+        struct Collector : btDbvt::ICollide {
+            std::vector<Entry> const * entries;
+            btTransform from, to;
+            btCollisionWorld::ClosestRayResultCallback * callback;
+            int group, mask;
+            void Process(btDbvtNode const * leaf) override
+            {
+                Entry const & entry = (* entries)[leaf->dataAsInt];
+                if ((entry.group & mask) == 0 || (group & entry.mask) == 0) return;
+                btCollisionWorld::rayTestSingle(from, to, entry.object, entry.shape, entry.transform, * callback);
+            }
+        };
+
+        hits.objects.resize(count); hits.fractions.resize(count);
+        hits.points.resize(count);  hits.normals.resize(count);
+        mScheduler.parallel_for(count, kGrain, [&](std::size_t begin, std::size_t end) {
+            static thread_local btAlignedObjectArray<btDbvtNode const *> stack;
+            for (std::size_t i = begin; i < end; i++)
+            {
+                btCollisionWorld::ClosestRayResultCallback callback(from[i], to[i]);
+                btVector3 delta = to[i] - from[i];
+                btScalar length = delta.length();
+                if (mTree.m_root && length > btScalar(0))
+                {
+                    btVector3 direction = delta / length, inverse;
+                    unsigned int signs[3];
+                    for (int j = 0; j < 3; j++)
+                    {
+                        inverse[j] = direction[j] == btScalar(0) ? BT_LARGE_FLOAT : btScalar(1) / direction[j];
+                        signs[j] = inverse[j] < btScalar(0);
+                    }
+
+                    Collector collector;
+                    collector.entries = & mEntries;
+                    collector.from = btTransform(btQuaternion::getIdentity(), from[i]);
+                    collector.to = btTransform(btQuaternion::getIdentity(), to[i]);
+                    collector.callback = & callback;
+                    collector.group = group; collector.mask = mask;
+                    mTree.rayTestInternal(mTree.m_root, from[i], to[i], inverse, signs, length,
+                                          btVector3(0, 0, 0), btVector3(0, 0, 0), stack, collector);
+                }
+
+                bool hit = callback.hasHit();
+                hits.objects[i]   = hit ? callback.m_collisionObject : nullptr;
+                hits.fractions[i] = hit ? callback.m_closestHitFraction : btScalar(1);
+                hits.points[i]    = hit ? callback.m_hitPointWorld : to[i];
+                hits.normals[i]   = hit ? callback.m_hitNormalWorld : btVector3(0, 0, 0);
+            }
+        });
+    }
+
+    void Queries::sweep(btConvexShape const * shape, btTransform const * from, btTransform const * to,
+                        std::size_t count, Hits & hits, int group, int mask) const
+    {
+        // Leaves Overlapping the Box Around Both Ends of the Sweep Get a Convex Cast
+        struct Collector : btDbvt::ICollide {
+            std::vector<Entry> const * entries;
+            btConvexShape const * shape;
+            btTransform const * from, * to;
+            btCollisionWorld::ClosestConvexResultCallback * callback;
+            int group, mask;
+            void Process(btDbvtNode const * leaf) override
+            {
+                Entry const & entry = (* entries)[leaf->dataAsInt];
+                if ((entry.group & mask) == 0 || (group & entry.mask) == 0) return;
+                btCollisionWorld::objectQuerySingle(shape, * from, * to, entry.object, entry.shape,
+                                                    entry.transform, * callback, btScalar(0));
+            }
+        };
+
+        hits.objects.resize(count); hits.fractions.resize(count);
+        hits.points.resize(count);  hits.normals.resize(count);
+        mScheduler.parallel_for(count, kGrain, [&](std::size_t begin, std::size_t end) {
+            static thread_local btAlignedObjectArray<btDbvtNode const *> stack;
+            for (std::size_t i = begin; i < end; i++)
+            {
+                btCollisionWorld::ClosestConvexResultCallback callback(from[i].getOrigin(), to[i].getOrigin());
+                if (mTree.m_root)
+                {
+                    btVector3 lower, upper, lowerEnd, upperEnd;
+                    shape->getAabb(from[i], lower, upper);
+                    shape->getAabb(to[i], lowerEnd, upperEnd);
+                    lower.setMin(lowerEnd); upper.setMax(upperEnd);
+
+                    Collector collector;
+                    collector.entries = & mEntries;
+                    collector.shape = shape;
+                    collector.from = & from[i]; collector.to = & to[i];
+                    collector.callback = & callback;
+                    collector.group = group; collector.mask = mask;
+                    mTree.collideTVNoStackAlloc(mTree.m_root, btDbvtVolume::FromMM(lower, upper), stack, collector);
+                }
+
+                bool hit = callback.hasHit();
+                hits.objects[i]   = hit ? callback.m_hitCollisionObject : nullptr;
+                hits.fractions[i] = hit ? callback.m_closestHitFraction : btScalar(1);
+                hits.points[i]    = hit ? callback.m_hitPointWorld : to[i].getOrigin();
+                hits.normals[i]   = hit ? callback.m_hitNormalWorld : btVector3(0, 0, 0);
+            }
+        });
+    }
+};
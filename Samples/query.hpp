@@ -0,0 +1,83 @@
+#pragma once
+
+// Local Headers
+#include "jobs.hpp"
+
+// System Headers
+#include <btBulletDynamicsCommon.h>
+#include <BulletCollision/BroadphaseCollision/btDbvt.h>
+
+// Standard Headers
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Results of a Batch, One Slot per Query; Objects are Null on a Miss
+    struct Hits {
+        std::vector<btCollisionObject const *> objects;
+        std::vector<btScalar>  fractions;
+        std::vector<btVector3> points;
+        std::vector<btVector3> normals;
+        std::size_t size() const { return objects.size(); }
+    };
+
+    // Batched Ray and Convex Sweep Queries Fanned Across the Scheduler.
+    // snapshot() Copies Object Bounds, Transforms and Filters into a Private
+    // Dynamic AABB Tree Between Steps (Refitting Only What Moved); Queries
+    // Only Read that Copy, so they May Run While the World Steps Again.
+    // Collision Shapes are Assumed Not to Change While Queries Run.
+    class Queries
+    {
+    public:
+
+        // Implement Custom Constructor
+        Queries(Scheduler & scheduler, btCollisionWorld & world);
+
+        // Public Member Functions
+        void snapshot();
+        void raycast(btVector3 const * from, btVector3 const * to, std::size_t count, Hits & hits,
+                     int group = btBroadphaseProxy::DefaultFilter, int mask = btBroadphaseProxy::AllFilter) const;
+        void sweep(btConvexShape const * shape, btTransform const * from, btTransform const * to,
+                   std::size_t count, Hits & hits,
+                   int group = btBroadphaseProxy::DefaultFilter, int mask = btBroadphaseProxy::AllFilter) const;
+
+    private:
+
+        // Disable Copying and Assignment
+        Queries(Queries const &) = delete;
+        Queries & operator=(Queries const &) = delete;
+
+        // Queries per Job
+        static const std::size_t kGrain = 64;
+
+        // Snapshot of One Collision Object
+        struct Entry {
+            btCollisionObject * object;
+            btCollisionShape const * shape;
+            btTransform transform;
+            btVector3 lower;
+            btVector3 upper;
+            btDbvtNode * leaf;
+            int group;
+            int mask;
+            std::uint32_t stamp;
+        };
+
+        // Private Member Functions
+        void erase(std::size_t index);
+
+        // Private Member Containers
+        std::vector<Entry> mEntries;
+        std::unordered_map<btCollisionObject const *, std::size_t> mIndices;
+
+        // Private Member Variables
+        Scheduler & mScheduler;
+        btCollisionWorld & mWorld;
+        btDbvt mTree;
+        std::uint32_t mStamp = 0;
+
+    };
+};
@@ -0,0 +1,207 @@
+// Local Headers
+#include "reload.hpp"
+
+// System Headers
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Standard Headers
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+// GL_KHR_parallel_shader_compile, Loaded by Hand Since glad Doesn't Include It
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+// Define Namespace
+namespace Mirage
+{
+    Reloader::Reloader(GLFWwindow * window) : mRunning(false)
+    {
+        // Hidden Window Whose Context Shares Objects with the Main One
+        glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+        mContext = glfwCreateWindow(1, 1, "Reloader", nullptr, window);
+        glfwWindowHint(GLFW_VISIBLE, GL_TRUE);
+        if (mContext == nullptr) { fprintf(stderr, "Failed to Create Reloader Context\n"); return; }
+        mParallel = glfwExtensionSupported("GL_KHR_parallel_shader_compile") == GL_TRUE;
+
+#if defined(__linux__)
+        // Editors Either Write in Place or Rename a Temporary Over the File
+        mWatcher = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (mWatcher != -1 && inotify_add_watch(mWatcher, kShaderDirectory, IN_CLOSE_WRITE | IN_MOVED_TO) == -1)
+        { close(mWatcher); mWatcher = -1; }
+#endif
+        if (mWatcher == -1) { fprintf(stderr, "Shader Hot Reload Unavailable\n"); return; }
+        mRunning = true;
+        mThread = std::thread(& Reloader::run, this);
+    }
+
+    Reloader::~Reloader()
+    {
+        mRunning = false;
+        if (mThread.joinable()) mThread.join();
+#if defined(__linux__)
+        if (mWatcher != -1) close(mWatcher);
+#endif
+        for (auto &i : mResults) { glDeleteSync(i.fence); glDeleteProgram(i.program); }
+        if (mContext) glfwDestroyWindow(mContext);
+    }
+
+    void Reloader::watch(Shader & shader, std::vector<std::string> const & filenames, Callback callback)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.push_back({ & shader, filenames, callback, false });
+    }
+
+    void Reloader::update()
+    {
+        // Never Wait on the Watcher; Anything Missed Now is Picked Up Next Frame
+        std::unique_lock<std::mutex> lock(mMutex, std::try_to_lock);
+        if (lock.owns_lock() == false) return;
+        for (auto i = mResults.begin(); i != mResults.end();)
+        {
+            // Only a Signaled Fence Means the Link Finished; a Failed Wait Drops the Build
+            GLenum status = glClientWaitSync(i->fence, 0, 0);
+            if (status == GL_TIMEOUT_EXPIRED) { ++i; continue; }
+            glDeleteSync(i->fence);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            {
+                fprintf(stderr, "Failed to Wait on Shader Rebuild: 0x%x\n", status);
+                glDeleteProgram(i->program);
+                i = mResults.erase(i);
+                continue;
+            }
+            auto & entry = mEntries[i->entry];
+            entry.shader->replace(i->program);
+            if (entry.callback) entry.callback(* entry.shader);
+            i = mResults.erase(i);
+        }
+    }
+
+    void Reloader::run()
+    {
+        glfwMakeContextCurrent(mContext);
+        if (mParallel)
+        {
+            // Let the Driver Use as Many Compiler Threads as it Likes
+            auto threads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+            if (threads) threads(0xFFFFFFFF);
+        }
+
+#if defined(__linux__)
+        alignas(inotify_event) char buffer[4096];
+        while (mRunning)
+        {
+            pollfd fd = { mWatcher, POLLIN, 0 };
+            if (poll(& fd, 1, 100) <= 0) continue;
+
+            // Give Editors Writing in Several Steps a Moment to Finish
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            std::vector<std::size_t> dirty;
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                ssize_t length;
+                while ((length = read(mWatcher, buffer, sizeof(buffer))) > 0)
+                for (char * p = buffer; p < buffer + length;)
+                {
+                    auto event = reinterpret_cast<inotify_event *>(p);
+                    p += sizeof(inotify_event) + event->len;
+                    if (event->len == 0) continue;
+                    for (auto &i : mEntries)
+                        if (std::find(i.filenames.begin(), i.filenames.end(), event->name) != i.filenames.end())
+                            i.dirty = true;
+                }
+
+                for (std::size_t i = 0; i < mEntries.size(); i++)
+                    if (mEntries[i].dirty) { mEntries[i].dirty = false; dirty.push_back(i); }
+            }
+            if (dirty.empty() == false) build(dirty);
+        }
+#endif
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    void Reloader::build(std::vector<std::size_t> const & entries)
+    {
+        // Issue Every Compile and Link First so a Parallel Driver Overlaps Them
+        std::vector<std::vector<GLuint>> shaders(entries.size());
+        std::vector<GLuint> programs(entries.size());
+        for (std::size_t i = 0; i < entries.size(); i++)
+        {
+            programs[i] = glCreateProgram();
+            std::vector<std::string> filenames;
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                filenames = mEntries[entries[i]].filenames;
+            }
+            for (auto &j : filenames) shaders[i].push_back(compile(j, programs[i]));
+            glLinkProgram(programs[i]);
+        }
+
+        for (std::size_t i = 0; i < entries.size(); i++)
+        {
+            while (finished(programs[i]) == false)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            // Display the Build Logs on Error and Keep the Old Program
+            GLint linked, status, length;
+            glGetProgramiv(programs[i], GL_LINK_STATUS, & linked);
+            if (linked == GL_FALSE)
+            {
+                for (auto j : shaders[i])
+                {
+                    glGetShaderiv(j, GL_COMPILE_STATUS, & status);
+                    if (status == GL_TRUE) continue;
+                    glGetShaderiv(j, GL_INFO_LOG_LENGTH, & length);
+                    std::unique_ptr<char[]> buffer(new char[length + 1]());
+                    glGetShaderInfoLog(j, length, nullptr, buffer.get());
+                    fprintf(stderr, "%s", buffer.get());
+                }
+                glGetProgramiv(programs[i], GL_INFO_LOG_LENGTH, & length);
+                std::unique_ptr<char[]> buffer(new char[length + 1]());
+                glGetProgramInfoLog(programs[i], length, nullptr, buffer.get());
+                fprintf(stderr, "Shader Reload Failed\n%s", buffer.get());
+            }
+            for (auto j : shaders[i]) { glDetachShader(programs[i], j); glDeleteShader(j); }
+            if (linked == GL_FALSE) { glDeleteProgram(programs[i]); continue; }
+
+            // Fence so the Render Context Only Swaps Once the Program is Complete
+            GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glFlush();
+            std::lock_guard<std::mutex> lock(mMutex);
+            mResults.push_back({ entries[i], programs[i], fence });
+        }
+    }
+
+    GLuint Reloader::compile(std::string const & filename, GLuint program)
+    {
+        std::string path = kShaderDirectory;
+        std::ifstream fd(path + filename);
+        auto src = std::string(std::istreambuf_iterator<char>(fd),
+                              (std::istreambuf_iterator<char>()));
+
+        const char * source = src.c_str();
+        GLuint shader = Shader::create(filename);
+        glShaderSource(shader, 1, & source, nullptr);
+        glCompileShader(shader);
+        glAttachShader(program, shader);
+        return shader;
+    }
+
+    bool Reloader::finished(GLuint program) const
+    {
+        // Without the Extension, Querying Link Status Simply Blocks this Thread
+        if (mParallel == false) return true;
+        GLint status = GL_FALSE;
+        glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, & status);
+        return status == GL_TRUE;
+    }
+};
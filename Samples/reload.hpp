@@ -0,0 +1,82 @@
+#pragma once
+
+// Local Headers
+#include "shader.hpp"
+
+// System Headers
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Standard Headers
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Watches the Shader Directory with inotify and Rebuilds Programs whose
+    // Sources Change on a Background Thread with its Own Shared Context, so
+    // Compiling Never Stalls Rendering. Finished Programs are Swapped in by
+    // update() at the Start of a Frame; if a Build Fails, the Log is Printed
+    // and the Old Program Stays in Use.
+    class Reloader
+    {
+    public:
+
+        // Called After a Swap so Callers Can Restore Block Bindings, Samplers, ...
+        typedef std::function<void (Shader &)> Callback;
+
+        // Implement Custom Constructor and Destructor; Call from the Main Thread
+         Reloader(GLFWwindow * window);
+        ~Reloader();
+
+        // Public Member Functions
+        void watch(Shader & shader, std::vector<std::string> const & filenames,
+                   Callback callback = nullptr);
+        void update();
+
+    private:
+
+        // Disable Copying and Assignment
+        Reloader(Reloader const &) = delete;
+        Reloader & operator=(Reloader const &) = delete;
+
+        // Watched Program and the Files it Was Built From
+        struct Entry {
+            Shader * shader;
+            std::vector<std::string> filenames;
+            Callback callback;
+            bool dirty;
+        };
+
+        // Program Linked in the Background, Waiting for a Frame Boundary
+        struct Result {
+            std::size_t entry;
+            GLuint program;
+            GLsync fence;
+        };
+
+        // Private Member Functions
+        void   run();
+        void   build(std::vector<std::size_t> const & entries);
+        GLuint compile(std::string const & filename, GLuint program);
+        bool   finished(GLuint program) const;
+
+        // Private Member Containers
+        std::vector<Entry>  mEntries;
+        std::vector<Result> mResults;
+
+        // Private Member Variables
+        std::mutex    mMutex;
+        std::thread   mThread;
+        std::atomic<bool> mRunning;
+        GLFWwindow *  mContext;
+        int           mWatcher = -1;
+        bool          mParallel = false;
+
+    };
+};
@@ -0,0 +1,174 @@
+// Local Headers
+#include "resolution.hpp"
+
+// Standard Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// Define Namespace
+namespace Mirage
+{
+    // Aim a Little Under Budget and Smooth the Cost; Climb a Fraction of the
+    // Way per Result, and Ignore Corrections Within the Dead Band Unless Over
+    static const float kHeadroom  = 0.9f;
+    static const float kSmoothing = 0.1f;
+    static const float kRise      = 0.05f;
+    static const float kDeadBand  = 0.02f;
+
+    // Target Sizes Snap to Multiples of kAlign so Small Changes Don't Jitter
+    static const int kAlign = 8;
+
+    static int align(float size)
+    {
+        return std::max(kAlign, int(std::round(size / kAlign)) * kAlign);
+    }
+
+    Resolution::Resolution(int width, int height, float budget, float minimum, float maximum)
+        : mTiming(false)
+        , mScissor(false)
+        , mTarget(0)
+        , mBudget(budget)
+        , mMinimum(minimum)
+        , mMaximum(maximum)
+        , mScale(maximum)
+        , mCost(0.0f)
+        , mTime(0.0f)
+        , mWidth(width)
+        , mHeight(height)
+    {
+        // Some Implementations Expose the Query but Always Return Zero Bits
+        GLint bits = 0;
+        glGetQueryiv(GL_TIME_ELAPSED, GL_QUERY_COUNTER_BITS, & bits);
+        mTimers = bits > 0;
+        if (mTimers) glGenQueries(kQueries, mQueries);
+        for (auto &i : mPending) i = false;
+        resize();
+
+        // Sized for the Largest Scale; Smaller Scales Only Use the Lower Left
+        int widest = align(std::ceil(width * maximum)), tallest = align(std::ceil(height * maximum));
+        GLint previous;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, & previous);
+        glGenFramebuffers(1, & mFramebuffer);
+        glGenRenderbuffers(2, mRenderbuffers);
+        glBindRenderbuffer(GL_RENDERBUFFER, mRenderbuffers[0]);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, widest, tallest);
+        glBindRenderbuffer(GL_RENDERBUFFER, mRenderbuffers[1]);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, widest, tallest);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mRenderbuffers[0]);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mRenderbuffers[1]);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            fprintf(stderr, "Incomplete Resolution Target: %dx%d\n", widest, tallest);
+        glBindFramebuffer(GL_FRAMEBUFFER, previous);
+    }
+
+    Resolution::~Resolution()
+    {
+        if (mTimers) glDeleteQueries(kQueries, mQueries);
+        glDeleteFramebuffers(1, & mFramebuffer);
+        glDeleteRenderbuffers(2, mRenderbuffers);
+    }
+
+    void Resolution::begin()
+    {
+        if (mTimers) collect();
+
+        // Present Later to Whatever the Caller Was Drawing Into
+        glGetIntegerv(GL_VIEWPORT, mViewport);
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, & mTarget);
+        glGetIntegerv(GL_SCISSOR_BOX, mBox);
+        mScissor = glIsEnabled(GL_SCISSOR_TEST) == GL_TRUE;
+
+        // The Scissor Keeps Clears from Touching the Unused Part of the Target
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glViewport(0, 0, mScaledWidth, mScaledHeight);
+        glScissor(0, 0, mScaledWidth, mScaledHeight);
+        glEnable(GL_SCISSOR_TEST);
+
+        // Skip a Frame's Timing Rather than Wait on a Query Still in Flight
+        mTiming = !mTimers || !mPending[mQuery];
+        if (mTimers && mTiming)
+        {
+            mScales[mQuery] = mScale;
+            glBeginQuery(GL_TIME_ELAPSED, mQueries[mQuery]);
+        }
+        else if (mTiming) mStart = std::chrono::steady_clock::now();
+    }
+
+    void Resolution::end()
+    {
+        // The Scale May Change Below, so Present What Was Actually Drawn
+        int width = mScaledWidth, height = mScaledHeight;
+        float elapsed = -1.0f;
+        if (mTimers && mTiming)
+        {
+            glEndQuery(GL_TIME_ELAPSED);
+            mPending[mQuery] = true;
+            mQuery = (mQuery + 1) % kQueries;
+        }
+        else if (mTiming)
+        {
+            glFinish();
+            elapsed = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - mStart).count();
+        }
+
+        // Blits are Scissored Too
+        glDisable(GL_SCISSOR_TEST);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, mFramebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, mTarget);
+        glBlitFramebuffer(0, 0, width, height,
+                          mViewport[0], mViewport[1], mViewport[0] + mViewport[2], mViewport[1] + mViewport[3],
+                          GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        glBindFramebuffer(GL_FRAMEBUFFER, mTarget);
+        glViewport(mViewport[0], mViewport[1], mViewport[2], mViewport[3]);
+        glScissor(mBox[0], mBox[1], mBox[2], mBox[3]);
+        if (mScissor) glEnable(GL_SCISSOR_TEST);
+        if (elapsed >= 0.0f) adapt(elapsed, mScale);
+    }
+
+    void Resolution::collect()
+    {
+        // Queries Finish in Order, so Stop at the First One Still Running
+        for (unsigned int i = 0; i < kQueries; i++)
+        {
+            unsigned int slot = (mQuery + i) % kQueries;
+            if (!mPending[slot]) continue;
+
+            GLint available = 0;
+            glGetQueryObjectiv(mQueries[slot], GL_QUERY_RESULT_AVAILABLE, & available);
+            if (!available) break;
+
+            GLuint64 nanoseconds = 0;
+            glGetQueryObjectui64v(mQueries[slot], GL_QUERY_RESULT, & nanoseconds);
+            mPending[slot] = false;
+            adapt(float(nanoseconds) * 1e-6f, mScales[slot]);
+        }
+    }
+
+    void Resolution::adapt(float time, float scale)
+    {
+        // Results Lag a Few Frames Behind; Dividing Out the Pixel Count they
+        // Were Measured at Gives a Cost Comparable Across Scales
+        mTime = time;
+        float cost = time / (scale * scale);
+        if (mCost <= 0.0f) mCost = cost;
+        else if (time > mBudget) mCost = std::max(mCost, cost);
+        else mCost += kSmoothing * (cost - mCost);
+
+        // Time Goes with Pixels, so the Scale Goes with the Square Root
+        float target = mCost > 0.0f ? std::sqrt(mBudget * kHeadroom / mCost) : mMaximum;
+        target = std::min(std::max(target, mMinimum), mMaximum);
+        if (target < mScale && (time > mBudget || mScale - target > kDeadBand)) mScale = target;
+        else if (target - mScale > kDeadBand) mScale += kRise * (target - mScale);
+        resize();
+    }
+
+    void Resolution::resize()
+    {
+        mScaledWidth  = align(mWidth  * mScale);
+        mScaledHeight = align(mHeight * mScale);
+    }
+};
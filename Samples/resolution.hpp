@@ -0,0 +1,85 @@
+#pragma once
+
+// System Headers
+#include <glad/glad.h>
+
+// Standard Headers
+#include <chrono>
+
+// Define Namespace
+namespace Mirage
+{
+    // Dynamic Resolution: the Scene Renders Offscreen into a Corner of a Target
+    // Allocated Once at the Largest Scale, so Changing Scale Never Reallocates.
+    // A Ring of GL_TIME_ELAPSED Queries Measures the Scene Pass Without
+    // Stalling, and a Feedback Controller Sizes the Corner to Keep the Pass
+    // Within `budget` Milliseconds of GPU Time: it Drops at Once When a Frame
+    // Runs Over, and Climbs Back Slowly. end() Upscales to the Viewport and
+    // Framebuffer that were Bound at begin(). Without Timer Queries (Some
+    // Software Rasterizers) the Pass is Timed on the CPU After a glFinish():
+    //
+    //     resolution.begin();
+    //     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    //     scene.draw();
+    //     resolution.end();
+    class Resolution
+    {
+    public:
+
+        // Timer Queries in Flight
+        static const unsigned int kQueries = 4;
+
+        // Implement Custom Constructor and Destructor
+         Resolution(int width, int height, float budget = 16.0f,
+                    float minimum = 0.5f, float maximum = 1.0f);
+        ~Resolution();
+
+        // begin() Adapts the Scale and Binds the Target; end() Presents it
+        void begin();
+        void end();
+
+        // Public Member Functions
+        float scale()  const { return mScale; }
+        float time()   const { return mTime; }
+        int   width()  const { return mScaledWidth; }
+        int   height() const { return mScaledHeight; }
+        GLuint framebuffer() const { return mFramebuffer; }
+
+    private:
+
+        // Disable Copying and Assignment
+        Resolution(Resolution const &) = delete;
+        Resolution & operator=(Resolution const &) = delete;
+
+        // Private Member Functions
+        void collect();
+        void adapt(float time, float scale);
+        void resize();
+
+        // Private Member Variables
+        std::chrono::steady_clock::time_point mStart;
+        GLuint mQueries[kQueries];
+        float  mScales[kQueries];
+        bool   mPending[kQueries];
+        bool   mTiming;
+        bool   mTimers;
+        bool   mScissor;
+        GLint  mViewport[4];
+        GLint  mBox[4];
+        GLint  mTarget;
+        GLuint mFramebuffer;
+        GLuint mRenderbuffers[2];
+        float  mBudget;
+        float  mMinimum;
+        float  mMaximum;
+        float  mScale;
+        float  mCost;
+        float  mTime;
+        int    mWidth;
+        int    mHeight;
+        int    mScaledWidth;
+        int    mScaledHeight;
+        unsigned int mQuery = 0;
+
+    };
+};
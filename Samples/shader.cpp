@@ -1,4 +1,5 @@
 // Local Headers
+#include "package.hpp"
 #include "shader.hpp"
 
 // Standard Headers
@@ -16,16 +17,25 @@ namespace Mirage
     }
 
     void Shader::bind(unsigned int location, float value) { glUniform1f(location, value); }
+    void Shader::bind(unsigned int location, glm::vec3 const & vector)
+    { glUniform3fv(location, 1, glm::value_ptr(vector)); }
+    void Shader::bind(unsigned int location, glm::vec4 const & vector)
+    { glUniform4fv(location, 1, glm::value_ptr(vector)); }
     void Shader::bind(unsigned int location, glm::mat4 const & matrix)
     { glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix)); }
 
     Shader & Shader::attach(std::string const & filename)
     {
-        // Load GLSL Shader Source from File
-        std::string path = PROJECT_SOURCE_DIR "/Mirage/Shaders/";
-        std::ifstream fd(path + filename);
-        auto src = std::string(std::istreambuf_iterator<char>(fd),
-                              (std::istreambuf_iterator<char>()));
+        // Load GLSL Shader Source from the Mounted Package, or Else from File
+        std::string path = kShaderDirectory, src;
+        Span span; std::vector<unsigned char> scratch;
+        if (Package::lookup(path + filename, span, scratch))
+            src.assign(reinterpret_cast<char const *>(span.data), span.size);
+        else
+        {
+            std::ifstream fd(path + filename);
+            src.assign(std::istreambuf_iterator<char>(fd), std::istreambuf_iterator<char>());
+        }
 
         // Create a Shader Object
         const char * source = src.c_str();
@@ -49,6 +59,15 @@ namespace Mirage
         return *this;
     }
 
+    Shader & Shader::block(std::string const & name, GLuint binding)
+    {
+        // Point a Named Uniform Block at a Shared Buffer Binding
+        GLuint index = glGetUniformBlockIndex(mProgram, name.c_str());
+        if (index == GL_INVALID_INDEX) fprintf(stderr, "Missing Uniform Block: %s\n", name.c_str());
+        else glUniformBlockBinding(mProgram, index, binding);
+        return *this;
+    }
+
     GLuint Shader::create(std::string const & filename)
     {
         auto index = filename.rfind(".");
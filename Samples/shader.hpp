@@ -11,6 +11,10 @@
 // Define Namespace
 namespace Mirage
 {
+    // Shader Sources are Read from Here by attach(), Permutations and the
+    // Reloader, Which Also Watches this Directory for Changes
+    static char const * const kShaderDirectory = PROJECT_SOURCE_DIR "/Mirage/Shaders/";
+
     class Shader
     {
     public:
@@ -22,12 +26,16 @@ namespace Mirage
         // Public Member Functions
         Shader & activate();
         Shader & attach(std::string const & filename);
-        GLuint   create(std::string const & filename);
+        static GLuint create(std::string const & filename);
         GLuint   get() { return mProgram; }
         Shader & link();
+        Shader & replace(GLuint program) { glDeleteProgram(mProgram); mProgram = program; return *this; }
+        Shader & block(std::string const & name, GLuint binding);
 
         // Wrap Calls to glUniform
         void bind(unsigned int location, float value);
+        void bind(unsigned int location, glm::vec3 const & vector);
+        void bind(unsigned int location, glm::vec4 const & vector);
         void bind(unsigned int location, glm::mat4 const & matrix);
         template<typename T> Shader & bind(std::string const & name, T&& value)
         {
@@ -0,0 +1,163 @@
+// Local Headers
+#include "shadows.hpp"
+
+// System Headers
+#include <glm/gtc/matrix_transform.hpp>
+
+// Standard Headers
+#include <algorithm>
+#include <cmath>
+
+// Define Namespace
+namespace Mirage
+{
+    // Blend of Logarithmic and Uniform Splits; Higher Favors Near Cascades
+    static const float kLambda = 0.75f;
+
+    // Cascade Half Extent Relative to its Slice's Bounding Sphere; Leaves Room
+    // for the Center to Lag by Half a Step Along Each Axis
+    static const float kMargin = 1.2f;
+
+    Shadows::Shadows(float casters)
+        : mSplits(0.0f), mCasters(casters)
+    {
+        mShader.attach("shadow.vert").attach("shadow.frag").link();
+        for (auto &i : mCached) i = false;
+        for (auto &i : mStale) i = true;
+
+        // The Map Compares Depths in the Sampler for Filtered Lookups; Pages
+        // Only Hold Static Depths Waiting to be Copied
+        GLuint textures[2];
+        glGenTextures(2, textures);
+        mMap = textures[0];
+        mPages = textures[1];
+        for (GLuint texture : textures)
+        {
+            GLint filter = texture == mMap ? GL_LINEAR : GL_NEAREST;
+            glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT32F, kResolution, kResolution, kCascades,
+                         0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, filter);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, filter);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mMap);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+        // Depth-Only Targets: One for the Map, One for the Pages
+        glGenFramebuffers(2, mFramebuffers);
+        for (GLuint framebuffer : mFramebuffers)
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            glDrawBuffer(GL_NONE);
+            glReadBuffer(GL_NONE);
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    Shadows::~Shadows()
+    {
+        glDeleteFramebuffers(2, mFramebuffers);
+        GLuint textures[] = { mMap, mPages };
+        glDeleteTextures(2, textures);
+    }
+
+    void Shadows::update(glm::mat4 const & view, glm::mat4 const & projection,
+                         float near, float far, glm::vec3 const & direction)
+    {
+        // Light Space Never Moves with the Camera, so Snapped Centers Stay Put
+        mInverseView = glm::inverse(view);
+        glm::vec3 up = std::abs(direction.y) > 0.99f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+        glm::mat4 light = glm::lookAt(glm::vec3(0.0f), direction, up);
+
+        // Slice Spheres Depend Only on the Projection, so Turning the Camera
+        // Never Resizes a Cascade; k is the Squared Tangent to a Far Corner
+        float k = 1.0f / (projection[0][0] * projection[0][0]) + 1.0f / (projection[1][1] * projection[1][1]);
+        float previous = near;
+        for (unsigned int c = 0; c < kCascades; c++)
+        {
+            float t = (c + 1) / float(kCascades);
+            float split = kLambda * near * std::pow(far / near, t) + (1.0f - kLambda) * (near + (far - near) * t);
+            float depth = std::min(split, 0.5f * (previous + split) * (1.0f + k));
+            float radius = std::sqrt((split - depth) * (split - depth) + split * split * k);
+            mSplits[c] = split;
+            previous = split;
+
+            // Move the Cascade Only in Whole Steps of kStep Texels
+            float extent = radius * kMargin;
+            float step = 2.0f * extent * kStep / kResolution;
+            glm::vec3 center = glm::vec3(light * mInverseView * glm::vec4(0.0f, 0.0f, -depth, 1.0f));
+            center = glm::floor(center / step + glm::vec3(0.5f)) * step;
+
+            // Any Change to the Matrix Means the Light Turned or the Cascade Stepped
+            glm::mat4 matrix = glm::ortho(center.x - extent, center.x + extent, center.y - extent, center.y + extent,
+                                          -center.z - extent - mCasters, -center.z + extent) * light;
+            mStale[c] = mStale[c] || !mCached[c] || matrix != mMatrices[c];
+            mMatrices[c] = matrix;
+        }
+
+        // Render State for Every Cascade Until end()
+        glGetIntegerv(GL_VIEWPORT, mViewport);
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, & mFramebuffer);
+        glViewport(0, 0, kResolution, kResolution);
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(2.0f, 4.0f);
+        mShader.activate();
+    }
+
+    void Shadows::target(GLuint framebuffer, GLuint texture, unsigned int cascade)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, texture, 0, cascade);
+    }
+
+    bool Shadows::statics(unsigned int cascade)
+    {
+        // Returns True When the Caller Must Redraw Static Casters into the Page
+        if (!mStale[cascade]) return false;
+        target(mFramebuffers[1], mPages, cascade);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        mCached[cascade] = true;
+        mStale[cascade] = false;
+        mRenders++;
+        return true;
+    }
+
+    void Shadows::dynamics(unsigned int cascade)
+    {
+        // Start from the Static Page, then the Caller Draws Moving Casters on Top
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, mFramebuffers[1]);
+        glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, mPages, 0, cascade);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, mFramebuffers[0]);
+        glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, mMap, 0, cascade);
+        glBlitFramebuffer(0, 0, kResolution, kResolution, 0, 0, kResolution, kResolution,
+                          GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+        target(mFramebuffers[0], mMap, cascade);
+    }
+
+    void Shadows::end()
+    {
+        glDisable(GL_POLYGON_OFFSET_FILL);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glViewport(mViewport[0], mViewport[1], mViewport[2], mViewport[3]);
+    }
+
+    void Shadows::bind(GLuint shader, GLuint unit) const
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mMap);
+        glUniform1i(glGetUniformLocation(shader, "shadow_map"), GLint(unit));
+
+        // Take View-Space Positions Straight to Shadow Map Coordinates
+        glm::mat4 bias(0.5f), matrices[kCascades];
+        bias[3] = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
+        for (unsigned int c = 0; c < kCascades; c++) matrices[c] = bias * mMatrices[c] * mInverseView;
+        glUniformMatrix4fv(glGetUniformLocation(shader, "cascade_matrices"), kCascades, GL_FALSE,
+                           glm::value_ptr(matrices[0]));
+        glUniform4fv(glGetUniformLocation(shader, "cascade_splits"), 1, glm::value_ptr(mSplits));
+    }
+};
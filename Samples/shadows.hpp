@@ -0,0 +1,78 @@
+#pragma once
+
+// Local Headers
+#include "shader.hpp"
+
+// System Headers
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Define Namespace
+namespace Mirage
+{
+    // Cascaded Shadow Maps for a Directional Light. Each Cascade Covers the
+    // Bounding Sphere of a Slice of the View Frustum, with a Margin so it Only
+    // Needs to Move in Coarse, Texel-Aligned Steps. Static Casters are Drawn
+    // into a Cached Page per Cascade Only When the Light Turns or the Cascade
+    // Steps; Each Frame Copies the Pages into the Shadow Map and Draws Just
+    // the Moving Casters on Top. Casters Up to `casters` Units Beyond a
+    // Cascade Toward the Light Still Land in it. Draw with Mesh::depth():
+    //
+    //     shadows.update(view, projection, near, far, sun);
+    //     for (unsigned int c = 0; c < Shadows::kCascades; c++) {
+    //         if (shadows.statics(c)) level.depth(shadows.program(), model, shadows.matrix(c));
+    //         shadows.dynamics(c);
+    //         crate.depth(shadows.program(), crateModel, shadows.matrix(c));
+    //     }   shadows.end();
+    class Shadows
+    {
+    public:
+
+        // Cascades, Texels per Side, and Texels per Cascade Step
+        static const unsigned int kCascades = 4;
+        static const unsigned int kResolution = 1024;
+        static const unsigned int kStep = 64;
+
+        // Implement Custom Constructor and Destructor
+         Shadows(float casters = 100.0f);
+        ~Shadows();
+
+        // update() Sets Up the Shadow Pass and end() Restores the Caller's Target
+        void update(glm::mat4 const & view, glm::mat4 const & projection,
+                    float near, float far, glm::vec3 const & direction);
+        void end();
+
+        // Public Member Functions
+        bool statics(unsigned int cascade);
+        void dynamics(unsigned int cascade);
+        void bind(GLuint shader, GLuint unit) const;
+        GLuint program() { return mShader.get(); }
+        glm::mat4 const & matrix(unsigned int cascade) const { return mMatrices[cascade]; }
+        unsigned int renders() const { return mRenders; }
+
+    private:
+
+        // Disable Copying and Assignment
+        Shadows(Shadows const &) = delete;
+        Shadows & operator=(Shadows const &) = delete;
+
+        // Private Member Functions
+        void target(GLuint framebuffer, GLuint texture, unsigned int cascade);
+
+        // Private Member Variables
+        Shader    mShader;
+        glm::mat4 mMatrices[kCascades];
+        glm::mat4 mInverseView;
+        glm::vec4 mSplits;
+        bool   mCached[kCascades];
+        bool   mStale[kCascades];
+        float  mCasters;
+        GLint  mViewport[4];
+        GLint  mFramebuffer;
+        GLuint mMap;
+        GLuint mPages;
+        GLuint mFramebuffers[2];
+        unsigned int mRenders = 0;
+
+    };
+};
@@ -0,0 +1,174 @@
+// Local Headers
+#include "simplify.hpp"
+
+// Standard Headers
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+
+// Define Namespace
+namespace Mirage
+{
+    namespace
+    {
+        // Weight of Normal and UV Deviation Relative to Squared Distance
+        const double kAttributeWeight = 0.01;
+
+        // Symmetric 4x4 Error Quadric Stored as its Upper Triangle
+        struct Quadric {
+            double a[10];
+        };
+
+        Quadric plane(glm::vec3 const & p0, glm::vec3 const & p1, glm::vec3 const & p2)
+        {
+            // Weight Each Face Plane by its Area so Slivers Count for Less
+            glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+            double area = glm::length(normal);
+            Quadric q = {{ 0 }};
+            if (area == 0.0) return q;
+
+            double a = normal.x / area, b = normal.y / area, c = normal.z / area;
+            double d = -(a * p0.x + b * p0.y + c * p0.z);
+            double v[10] = { a*a, a*b, a*c, a*d, b*b, b*c, b*d, c*c, c*d, d*d };
+            for (int i = 0; i < 10; i++) q.a[i] = v[i] * area;
+            return q;
+        }
+
+        void accumulate(Quadric & q, Quadric const & r)
+        {
+            for (int i = 0; i < 10; i++) q.a[i] += r.a[i];
+        }
+
+        double evaluate(Quadric const & q, glm::vec3 const & p)
+        {
+            double x = p.x, y = p.y, z = p.z;
+            double error = q.a[0]*x*x + 2*q.a[1]*x*y + 2*q.a[2]*x*z + 2*q.a[3]*x
+                         + q.a[4]*y*y + 2*q.a[5]*y*z + 2*q.a[6]*y
+                         + q.a[7]*z*z + 2*q.a[8]*z
+                         + q.a[9];
+            return std::max(error, 0.0);
+        }
+
+        // Candidate Collapse Moving Vertex `from` onto Vertex `to`
+        struct Collapse {
+            GLuint from;
+            GLuint to;
+            double cost;
+            bool operator<(Collapse const & other) const { return cost < other.cost; }
+        };
+    };
+
+    std::vector<GLuint> simplify(std::vector<Vertex> const & vertices,
+                                 std::vector<GLuint> const & indices,
+                                 std::size_t target, float * error)
+    {
+        // Weld Vertices Sharing a Position so Attribute Seams Stay Connected
+        std::vector<GLuint> remap(vertices.size());
+        std::vector<unsigned int> wedges(vertices.size(), 0);
+        std::map<std::tuple<float, float, float>, GLuint> positions;
+        for (GLuint i = 0; i < vertices.size(); i++)
+        {
+            auto const & p = vertices[i].position;
+            auto found = positions.insert(std::make_pair(std::make_tuple(p.x, p.y, p.z), i));
+            remap[i] = found.first->second;
+            wedges[remap[i]]++;
+        }
+
+        // Lock Seam and Boundary Vertices so Silhouettes and UV Borders Survive
+        std::vector<bool> locked(vertices.size(), false);
+        std::map<std::pair<GLuint, GLuint>, int> edges;
+        for (std::size_t i = 0; i < indices.size(); i += 3)
+        for (int j = 0; j < 3; j++)
+        {
+            GLuint a = remap[indices[i + j]], b = remap[indices[i + (j + 1) % 3]];
+            edges[std::make_pair(std::min(a, b), std::max(a, b))]++;
+        }
+        for (auto &i : edges) if (i.second == 1) locked[i.first.first] = locked[i.first.second] = true;
+        for (GLuint i = 0; i < vertices.size(); i++) if (wedges[remap[i]] > 1) locked[remap[i]] = true;
+
+        // Sum the Face Quadrics Touching Each Welded Position
+        std::vector<Quadric> quadrics(vertices.size(), Quadric {{ 0 }});
+        for (std::size_t i = 0; i < indices.size(); i += 3)
+        {
+            Quadric q = plane(vertices[indices[i]].position,
+                              vertices[indices[i + 1]].position,
+                              vertices[indices[i + 2]].position);
+            for (int j = 0; j < 3; j++) accumulate(quadrics[remap[indices[i + j]]], q);
+        }
+
+        double worst = 0.0;
+        std::vector<GLuint> result(indices);
+        std::vector<std::vector<GLuint>> adjacency(vertices.size());
+        std::vector<bool> dirty(vertices.size());
+        std::vector<GLuint> collapsed(vertices.size());
+        std::vector<Collapse> candidates;
+        while (result.size() > target)
+        {
+            // Rebuild Vertex to Triangle Adjacency for this Pass
+            for (auto &i : adjacency) i.clear();
+            for (std::size_t i = 0; i < result.size(); i += 3)
+            for (int j = 0; j < 3; j++) adjacency[result[i + j]].push_back(i);
+
+            // Cost Every Directed Edge; Collapsing Keeps the Target Vertex Untouched
+            candidates.clear();
+            for (std::size_t i = 0; i < result.size(); i += 3)
+            for (int j = 0; j < 3; j++)
+            {
+                GLuint from = result[i + j], to = result[i + (j + 1) % 3];
+                if (locked[remap[from]] || remap[from] == remap[to]) continue;
+                Quadric q = quadrics[remap[from]];
+                accumulate(q, quadrics[remap[to]]);
+                glm::vec3 dn = vertices[from].normal - vertices[to].normal;
+                glm::vec2 du = vertices[from].uv     - vertices[to].uv;
+                double cost = evaluate(q, vertices[to].position)
+                            + kAttributeWeight * (glm::dot(dn, dn) + glm::dot(du, du));
+                candidates.push_back(Collapse { from, to, cost });
+            }   std::sort(candidates.begin(), candidates.end());
+
+            // Greedily Apply the Cheapest Independent Collapses
+            std::size_t budget = (result.size() - target) / 6 + 1, applied = 0;
+            std::fill(dirty.begin(), dirty.end(), false);
+            for (GLuint i = 0; i < collapsed.size(); i++) collapsed[i] = i;
+            for (auto &c : candidates)
+            {
+                if (applied >= budget) break;
+                if (dirty[c.from] || dirty[c.to]) continue;
+
+                // Reject Collapses that Would Flip a Neighbouring Face
+                bool flips = false;
+                for (auto t : adjacency[c.from])
+                {
+                    GLuint a = result[t], b = result[t + 1], d = result[t + 2];
+                    if (a == c.to || b == c.to || d == c.to) continue;
+                    glm::vec3 p[3] = { vertices[a].position, vertices[b].position, vertices[d].position };
+                    glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+                    for (auto &k : p) if (k == vertices[c.from].position) k = vertices[c.to].position;
+                    glm::vec3 after  = glm::cross(p[1] - p[0], p[2] - p[0]);
+                    if (glm::dot(before, after) <= 0.0f) { flips = true; break; }
+                }   if (flips) continue;
+
+                // Freeze the Whole Neighbourhood Until the Next Pass
+                for (auto t : adjacency[c.from])
+                for (int k = 0; k < 3; k++) dirty[result[t + k]] = true;
+                dirty[c.to] = true;
+                collapsed[c.from] = c.to;
+                accumulate(quadrics[remap[c.to]], quadrics[remap[c.from]]);
+                worst = std::max(worst, c.cost);
+                applied++;
+            }   if (applied == 0) break;
+
+            // Rewrite Indices and Drop Triangles that Became Degenerate
+            std::size_t size = 0;
+            for (std::size_t i = 0; i < result.size(); i += 3)
+            {
+                GLuint a = collapsed[result[i]], b = collapsed[result[i + 1]], c = collapsed[result[i + 2]];
+                if (remap[a] == remap[b] || remap[b] == remap[c] || remap[c] == remap[a]) continue;
+                result[size++] = a; result[size++] = b; result[size++] = c;
+            }   result.resize(size);
+        }
+
+        if (error) *error = static_cast<float>(std::sqrt(worst));
+        return result;
+    }
+};
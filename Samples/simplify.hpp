@@ -0,0 +1,19 @@
+#pragma once
+
+// Local Headers
+#include "mesh.hpp"
+
+// Standard Headers
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Reduce a Triangle List Toward a Target Index Count Using Quadric Error
+    // Metrics. Vertices Only Ever Collapse onto Existing Vertices, so the
+    // Result Indexes the Same Vertex Buffer and Keeps its Normals and UVs.
+    // Returns the Simplified Indices and the Largest Geometric Error Introduced.
+    std::vector<GLuint> simplify(std::vector<Vertex> const & vertices,
+                                 std::vector<GLuint> const & indices,
+                                 std::size_t target, float * error = nullptr);
+};
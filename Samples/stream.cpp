@@ -0,0 +1,68 @@
+// Local Headers
+#include "stream.hpp"
+
+// Standard Headers
+#include <chrono>
+#include <cstdio>
+
+// Define Namespace
+namespace Mirage
+{
+    Streamer::Streamer(Scheduler & scheduler) : mScheduler(scheduler)
+    {
+        glGenBuffers(1, & mBuffer);
+    }
+
+    std::size_t Streamer::stage(Package const & package, std::string const & name)
+    {
+        auto entry = package.find(name);
+        if (entry == nullptr) { fprintf(stderr, "Missing Package Entry %s\n", name.c_str()); return 0; }
+        mSize = std::size_t(entry->original);
+        if (mSize == 0) return 0;
+        auto start = std::chrono::high_resolution_clock::now();
+
+        // Grow the Staging Buffer Only When Needed; Otherwise Invalidate It
+        glBindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+        if (mSize > mCapacity)
+        {
+            mCapacity = mSize;
+            glBufferData(GL_COPY_WRITE_BUFFER, mCapacity, nullptr, GL_STREAM_DRAW);
+        }
+        void * mapped = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, mSize,
+                                         GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+
+        // Worker Threads Write Blocks into the Mapping; Only Unmapping Needs GL
+        bool decoded = mapped && package.decode(* entry, mapped, & mScheduler);
+        if (mapped && glUnmapBuffer(GL_COPY_WRITE_BUFFER) == GL_FALSE) decoded = false;
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        if (decoded == false)
+        {
+            fprintf(stderr, "Failed to Stage %s\n", name.c_str());
+            return mSize = 0;
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+        mCompressed += entry->size; mUncompressed += mSize; mSeconds += elapsed.count();
+        fprintf(stderr, "%s: %llu -> %zu Bytes in %.2f ms (%.2f GB/s)\n", name.c_str(),
+                (unsigned long long) entry->size, mSize, elapsed.count() * 1e3, mSize / elapsed.count() / 1e9);
+        return mSize;
+    }
+
+    void Streamer::copy(GLenum target, GLuint destination, GLenum usage) const
+    {
+        // GPU-Side Copy Out of the Staging Buffer
+        glBindBuffer(GL_COPY_READ_BUFFER, mBuffer);
+        glBindBuffer(target, destination);
+        glBufferData(target, mSize, nullptr, usage);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, target, 0, 0, mSize);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    }
+
+    void Streamer::report() const
+    {
+        if (mSeconds <= 0.0) return;
+        fprintf(stderr, "Streamed %llu Compressed / %llu Uncompressed Bytes (%.1f%%) at %.2f GB/s\n",
+                (unsigned long long) mCompressed, (unsigned long long) mUncompressed,
+                mUncompressed ? 100.0 * mCompressed / mUncompressed : 0.0, mUncompressed / mSeconds / 1e9);
+    }
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+// Local Headers
+#include "jobs.hpp"
+#include "package.hpp"
+
+// System Headers
+#include <glad/glad.h>
+
+// Standard Headers
+#include <cstdint>
+#include <string>
+
+// Define Namespace
+namespace Mirage
+{
+    // Decompresses Package Entries Straight into a Mapped Staging Buffer,
+    // Spreading Block Entries Across the Scheduler, so Cooked Payloads Reach
+    // the GPU Without an Intermediate Copy. Use buffer() as a Pixel Unpack
+    // Source for Textures, or copy() it into a Vertex or Element Buffer.
+    class Streamer
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor
+         Streamer(Scheduler & scheduler);
+        ~Streamer() { glDeleteBuffers(1, & mBuffer); }
+
+        // Public Member Functions
+        std::size_t stage(Package const & package, std::string const & name);
+        void        copy(GLenum target, GLuint destination, GLenum usage = GL_STATIC_DRAW) const;
+        GLuint      buffer() const { return mBuffer; }
+        std::size_t size()   const { return mSize; }
+        void        report() const;
+
+    private:
+
+        // Disable Copying and Assignment
+        Streamer(Streamer const &) = delete;
+        Streamer & operator=(Streamer const &) = delete;
+
+        // Private Member Variables
+        Scheduler &   mScheduler;
+        GLuint        mBuffer;
+        std::size_t   mCapacity = 0;
+        std::size_t   mSize = 0;
+        std::uint64_t mCompressed = 0;
+        std::uint64_t mUncompressed = 0;
+        double        mSeconds = 0.0;
+
+    };
+};
@@ -0,0 +1,209 @@
+// Local Headers
+#include "sweep.hpp"
+
+// System Headers
+#include <LinearMath/btAabbUtil2.h>
+
+// Standard Headers
+#include <algorithm>
+#include <cstdio>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
+// Define Namespace
+namespace Mirage
+{
+    static bool overlaps(btVector3 const & lowerA, btVector3 const & upperA,
+                         btVector3 const & lowerB, btVector3 const & upperB)
+    {
+        return lowerA.x() <= upperB.x() && lowerB.x() <= upperA.x()
+            && lowerA.y() <= upperB.y() && lowerB.y() <= upperA.y()
+            && lowerA.z() <= upperB.z() && lowerB.z() <= upperA.z();
+    }
+
+    SortAndSweep::SortAndSweep()
+        : mPairs(new btHashedOverlappingPairCache())
+    {}
+
+    SortAndSweep::~SortAndSweep()
+    {}
+
+    btBroadphaseProxy * SortAndSweep::createProxy(btVector3 const & lower, btVector3 const & upper, int shapeType,
+                                                  void * user, int group, int mask, btDispatcher * dispatcher)
+    {
+        // New Proxies Join the Order on the Next Update
+        (void) shapeType; (void) dispatcher;
+        Proxy * proxy = new Proxy(lower, upper, user, group, mask);
+        proxy->m_uniqueId = mUniqueId++;
+        proxy->index = mProxies.size();
+        mProxies.push_back(std::unique_ptr<Proxy>(proxy));
+        return proxy;
+    }
+
+    void SortAndSweep::destroyProxy(btBroadphaseProxy * proxy, btDispatcher * dispatcher)
+    {
+        mPairs->removeOverlappingPairsContainingProxy(proxy, dispatcher);
+        std::size_t index = static_cast<Proxy *>(proxy)->index;
+        if (index + 1 != mProxies.size())
+        {
+            mProxies[index] = std::move(mProxies.back());
+            mProxies[index]->index = index;
+        }   mProxies.pop_back();
+        mStale = true;
+    }
+
+    void SortAndSweep::setAabb(btBroadphaseProxy * proxy, btVector3 const & lower, btVector3 const & upper,
+                               btDispatcher * dispatcher)
+    {
+        (void) dispatcher;
+        proxy->m_aabbMin = lower;
+        proxy->m_aabbMax = upper;
+    }
+
+    void SortAndSweep::getAabb(btBroadphaseProxy * proxy, btVector3 & lower, btVector3 & upper) const
+    {
+        lower = proxy->m_aabbMin;
+        upper = proxy->m_aabbMax;
+    }
+
+    void SortAndSweep::rayTest(btVector3 const & from, btVector3 const & to, btBroadphaseRayCallback & callback,
+                               btVector3 const & lower, btVector3 const & upper)
+    {
+        // Rays Cut Across the Sorted Axis, so Slab Test Every Proxy's Bounds
+        // (Grown by the Swept Shape's) Before the Callback's Narrowphase
+        (void) to;
+        btVector3 bounds[2];
+        btScalar lambda;
+        for (auto &i : mProxies)
+        {
+            bounds[0] = i->m_aabbMin - upper;
+            bounds[1] = i->m_aabbMax - lower;
+            if (btRayAabb2(from, callback.m_rayDirectionInverse, callback.m_signs, bounds,
+                           lambda, btScalar(0), callback.m_lambda_max)) callback.process(i.get());
+        }
+    }
+
+    void SortAndSweep::aabbTest(btVector3 const & lower, btVector3 const & upper, btBroadphaseAabbCallback & callback)
+    {
+        for (auto &i : mProxies)
+            if (overlaps(lower, upper, i->m_aabbMin, i->m_aabbMax)) callback.process(i.get());
+    }
+
+    void SortAndSweep::calculateOverlappingPairs(btDispatcher * dispatcher)
+    {
+        sort();
+        sweep();
+
+        // Drop Cached Pairs Whose Bounds Came Apart; Returning True Removes One
+        struct Stale : btOverlapCallback {
+            bool processOverlap(btBroadphasePair & pair) override
+            {
+                return !overlaps(pair.m_pProxy0->m_aabbMin, pair.m_pProxy0->m_aabbMax,
+                                 pair.m_pProxy1->m_aabbMin, pair.m_pProxy1->m_aabbMax);
+            }
+        } stale;
+        mPairs->processAllOverlappingPairs(& stale, dispatcher);
+    }
+
+    void SortAndSweep::sort()
+    {
+        // Sweep the Axis Where Centers Spread Most; Fewer Intervals Overlap on it
+        std::size_t count = mProxies.size();
+        btVector3 sum(0, 0, 0), squares(0, 0, 0);
+        for (auto &i : mProxies)
+        {
+            btVector3 center = (i->m_aabbMin + i->m_aabbMax) * btScalar(0.5f);
+            sum += center;
+            squares += center * center;
+        }
+
+        int axis = mAxis;
+        if (count > 0)
+        {
+            btVector3 variance = squares - sum * sum / btScalar(count);
+            axis = variance.maxAxis();
+        }
+
+        // Rebuild After Proxies Came or Went or the Axis Changed; Otherwise
+        // Insertion Sort Last Frame's Order, Which is Nearly Sorted Already
+        auto start = [axis](Proxy const * a) { return a->m_aabbMin[axis]; };
+        if (mStale || axis != mAxis || mOrder.size() != count)
+        {
+            mOrder.clear();
+            for (auto &i : mProxies) mOrder.push_back(i.get());
+            std::sort(mOrder.begin(), mOrder.end(),
+                      [&start](Proxy const * a, Proxy const * b) { return start(a) < start(b); });
+            mAxis = axis;
+            mStale = false;
+        }
+        else for (std::size_t i = 1; i < count; i++)
+        {
+            Proxy * proxy = mOrder[i];
+            btScalar key = start(proxy);
+            std::size_t j = i;
+            for (; j > 0 && start(mOrder[j - 1]) > key; j--) mOrder[j] = mOrder[j - 1];
+            mOrder[j] = proxy;
+        }
+
+        // Pack Bounds in Sweep Order so the Inner Loop Streams Through Memory
+        mBounds.resize(count); mStarts.resize(count); mEnds.resize(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            Proxy const * proxy = mOrder[i];
+            Bounds & bounds = mBounds[i];
+            for (int k = 0; k < 3; k++)
+            {
+                bounds.lower[k] = float(proxy->m_aabbMin[k]);
+                bounds.upper[k] = float(proxy->m_aabbMax[k]);
+            }
+            bounds.lower[3] = bounds.upper[3] = 0.0f;
+            mStarts[i] = bounds.lower[axis];
+            mEnds[i] = bounds.upper[axis];
+        }
+    }
+
+    void SortAndSweep::sweep()
+    {
+        // Later Proxies Start No Earlier; Stop at the First that Starts Past this End
+        std::size_t count = mOrder.size();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            float end = mEnds[i];
+#if defined(__SSE2__) || defined(_M_X64)
+            __m128 lower = _mm_loadu_ps(mBounds[i].lower);
+            __m128 upper = _mm_loadu_ps(mBounds[i].upper);
+            for (std::size_t j = i + 1; j < count && mStarts[j] <= end; j++)
+            {
+                __m128 apart = _mm_or_ps(_mm_cmplt_ps(upper, _mm_loadu_ps(mBounds[j].lower)),
+                                         _mm_cmplt_ps(_mm_loadu_ps(mBounds[j].upper), lower));
+                if (_mm_movemask_ps(apart) == 0) mPairs->addOverlappingPair(mOrder[i], mOrder[j]);
+            }
+#else
+            Bounds const & a = mBounds[i];
+            for (std::size_t j = i + 1; j < count && mStarts[j] <= end; j++)
+            {
+                Bounds const & b = mBounds[j];
+                bool apart = false;
+                for (int k = 0; k < 3; k++) apart |= a.upper[k] < b.lower[k] || b.upper[k] < a.lower[k];
+                if (!apart) mPairs->addOverlappingPair(mOrder[i], mOrder[j]);
+            }
+#endif
+        }
+    }
+
+    void SortAndSweep::getBroadphaseAabb(btVector3 & lower, btVector3 & upper) const
+    {
+        lower = upper = btVector3(0, 0, 0);
+        if (mProxies.empty()) return;
+        lower = mProxies.front()->m_aabbMin;
+        upper = mProxies.front()->m_aabbMax;
+        for (auto &i : mProxies) { lower.setMin(i->m_aabbMin); upper.setMax(i->m_aabbMax); }
+    }
+
+    void SortAndSweep::printStats()
+    {
+        fprintf(stdout, "Sort and Sweep: %lu Proxies, %d Pairs, Axis %d\n",
+                static_cast<unsigned long>(mProxies.size()), mPairs->getNumOverlappingPairs(), mAxis);
+    }
+};
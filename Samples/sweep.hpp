@@ -0,0 +1,83 @@
+#pragma once
+
+// System Headers
+#include <btBulletDynamicsCommon.h>
+#include <BulletCollision/BroadphaseCollision/btOverlappingPairCache.h>
+
+// Standard Headers
+#include <memory>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Sort-and-Sweep Broadphase: Each Update Sorts Proxies by their Lower
+    // Bound Along the Axis Where Centers Spread the Most, then Walks Forward
+    // from Each Proxy While the Next One Starts Before it Ends, Testing the
+    // Other Two Axes with One SSE Compare. The Order Persists Between Frames,
+    // so a Scene that Barely Moved Re-Sorts in Close to Linear Time. Pairs
+    // Live in Bullet's Hashed Pair Cache Like the Stock Broadphases. Ray and
+    // Box Queries Visit Every Proxy; Use Queries for Heavy Ray Traffic.
+    class SortAndSweep : public btBroadphaseInterface
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor
+         SortAndSweep();
+        ~SortAndSweep();
+
+        // Implement btBroadphaseInterface
+        btBroadphaseProxy * createProxy(btVector3 const & lower, btVector3 const & upper, int shapeType,
+                                        void * user, int group, int mask, btDispatcher * dispatcher) override;
+        void destroyProxy(btBroadphaseProxy * proxy, btDispatcher * dispatcher) override;
+        void setAabb(btBroadphaseProxy * proxy, btVector3 const & lower, btVector3 const & upper,
+                     btDispatcher * dispatcher) override;
+        void getAabb(btBroadphaseProxy * proxy, btVector3 & lower, btVector3 & upper) const override;
+        void rayTest(btVector3 const & from, btVector3 const & to, btBroadphaseRayCallback & callback,
+                     btVector3 const & lower = btVector3(0, 0, 0),
+                     btVector3 const & upper = btVector3(0, 0, 0)) override;
+        void aabbTest(btVector3 const & lower, btVector3 const & upper, btBroadphaseAabbCallback & callback) override;
+        void calculateOverlappingPairs(btDispatcher * dispatcher) override;
+        btOverlappingPairCache * getOverlappingPairCache() override { return mPairs.get(); }
+        btOverlappingPairCache const * getOverlappingPairCache() const override { return mPairs.get(); }
+        void getBroadphaseAabb(btVector3 & lower, btVector3 & upper) const override;
+        void printStats() override;
+
+    private:
+
+        // Disable Copying and Assignment
+        SortAndSweep(SortAndSweep const &) = delete;
+        SortAndSweep & operator=(SortAndSweep const &) = delete;
+
+        // Proxies Remember their Slot so Removal is a Swap
+        struct Proxy : public btBroadphaseProxy {
+            Proxy(btVector3 const & lower, btVector3 const & upper, void * user, int group, int mask)
+                : btBroadphaseProxy(lower, upper, user, group, mask) {}
+            std::size_t index;
+        };
+
+        // Bounds Packed in Sweep Order for SSE Loads
+        struct Bounds {
+            float lower[4];
+            float upper[4];
+        };
+
+        // Private Member Functions
+        void sort();
+        void sweep();
+
+        // Private Member Containers
+        std::vector<std::unique_ptr<Proxy>> mProxies;
+        std::vector<Proxy *> mOrder;
+        std::vector<Bounds> mBounds;
+        std::vector<float> mStarts;
+        std::vector<float> mEnds;
+
+        // Private Member Variables
+        std::unique_ptr<btOverlappingPairCache> mPairs;
+        int  mAxis = 0;
+        int  mUniqueId = 2;
+        bool mStale = false;
+
+    };
+};
@@ -0,0 +1,93 @@
+// Local Headers
+#include "package.hpp"
+#include "texture.hpp"
+
+// System Headers
+#include <stb_image.h>
+
+// Define Namespace
+namespace Mirage
+{
+    TextureArrays::~TextureArrays()
+    {
+        for (auto &i : mBuckets)
+        for (auto &j : i.second.images) stbi_image_free(j);
+        if (!mArrays.empty()) glDeleteTextures(mArrays.size(), & mArrays.front());
+    }
+
+    Layer TextureArrays::insert(std::string const & filename)
+    {
+        // Materials Often Share Textures; Only Load Each File Once
+        auto found = mLayers.find(filename);
+        if (found != mLayers.end()) return found->second;
+
+        // Load the Texture Image from the Mounted Package, or Else from File
+        int width, height, channels;
+        Span span; std::vector<unsigned char> scratch;
+        unsigned char * image = Package::lookup(filename, span, scratch)
+            ? stbi_load_from_memory(span.data, int(span.size), & width, & height, & channels, 0)
+            : stbi_load(filename.c_str(), & width, & height, & channels, 0);
+        if (!image)
+        {
+            fprintf(stderr, "%s %s\n", "Failed to Load Texture", filename.c_str());
+            return Layer { 0, -1 };
+        }
+
+        // Append the Image to the Array Matching its Size and Format
+        auto & bucket = mBuckets[std::make_tuple(width, height, channels)];
+        if (bucket.images.empty())
+        {
+            glGenTextures(1, & bucket.array);
+            mArrays.push_back(bucket.array);
+        }
+
+        Layer layer { bucket.array, static_cast<GLint>(bucket.images.size()) };
+        bucket.images.push_back(image);
+        mLayers.insert(std::make_pair(filename, layer));
+        return layer;
+    }
+
+    void TextureArrays::upload()
+    {
+        // Rows of stb Images are Tightly Packed; Restore the Caller's Alignment After
+        GLint alignment;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, & alignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (auto &i : mBuckets)
+        {
+            // Define Some Local Variables
+            GLenum format;
+            int width, height, channels;
+            std::tie(width, height, channels) = i.first;
+            auto & images = i.second.images;
+            if (images.empty()) continue;
+
+            // Set the Correct Channel Format
+            switch (channels)
+            {
+                case 1  : format = GL_RED;  break;
+                case 2  : format = GL_RG;   break;
+                case 3  : format = GL_RGB;  break;
+                default : format = GL_RGBA; break;
+            }
+
+            // Allocate Every Layer at Once, then Copy Each Image Into its Slice
+            glBindTexture(GL_TEXTURE_2D_ARRAY, i.second.array);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, format, width, height,
+                         images.size(), 0, format, GL_UNSIGNED_BYTE, nullptr);
+            for (unsigned int j = 0; j < images.size(); j++)
+                glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, j, width, height, 1,
+                                format, GL_UNSIGNED_BYTE, images[j]);
+            glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+
+            // Release Image Pointers Once They Live in VRAM
+            for (auto &j : images) stbi_image_free(j);
+            images.clear();
+        }   glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+    }
+};
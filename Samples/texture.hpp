@@ -0,0 +1,52 @@
+#pragma once
+
+// System Headers
+#include <glad/glad.h>
+
+// Standard Headers
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Slice of a Packed Texture Array
+    struct Layer {
+        GLuint array;
+        GLint  index;
+    };
+
+    class TextureArrays
+    {
+    public:
+
+        // Implement Default Constructor and Destructor
+         TextureArrays() = default;
+        ~TextureArrays();
+
+        // Public Member Functions
+        Layer insert(std::string const & filename);
+        void  upload();
+
+    private:
+
+        // Disable Copying and Assignment
+        TextureArrays(TextureArrays const &) = delete;
+        TextureArrays & operator=(TextureArrays const &) = delete;
+
+        // Images Sharing a Size and Format Pack Into One Array
+        typedef std::tuple<int, int, int> Key;
+        struct Bucket {
+            GLuint array;
+            std::vector<unsigned char *> images;
+        };
+
+        // Private Member Containers
+        std::map<Key, Bucket> mBuckets;
+        std::map<std::string, Layer> mLayers;
+        std::vector<GLuint> mArrays;
+
+    };
+};
@@ -0,0 +1,191 @@
+// Local Headers
+#include "transform.hpp"
+
+// System Headers
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
+// Standard Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// Define Namespace
+namespace Mirage
+{
+    // out = a * b; Each Column of the Result Sums the Columns of a Scaled by b
+    static void multiply(glm::mat4 const & a, glm::mat4 const & b, glm::mat4 & out)
+    {
+#if defined(__SSE2__) || defined(_M_X64)
+        __m128 columns[4];
+        for (int i = 0; i < 4; i++) columns[i] = _mm_loadu_ps(& a[i].x);
+        for (int i = 0; i < 4; i++)
+        {
+            __m128 r = _mm_mul_ps(columns[0], _mm_set1_ps(b[i].x));
+            r = _mm_add_ps(r, _mm_mul_ps(columns[1], _mm_set1_ps(b[i].y)));
+            r = _mm_add_ps(r, _mm_mul_ps(columns[2], _mm_set1_ps(b[i].z)));
+            r = _mm_add_ps(r, _mm_mul_ps(columns[3], _mm_set1_ps(b[i].w)));
+            _mm_storeu_ps(& out[i].x, r);
+        }
+#else
+        out = a * b;
+#endif
+    }
+
+    unsigned int Transforms::add(int parent, glm::mat4 const & local)
+    {
+        glm::vec3 translation, scale; glm::vec4 rotation;
+        decompose(local, translation, rotation, scale);
+        return add(parent, translation, rotation, scale);
+    }
+
+    unsigned int Transforms::add(int parent, glm::vec3 const & translation,
+                                 glm::vec4 const & rotation, glm::vec3 const & scale)
+    {
+        // Parents Must Already Exist, which Keeps the Array Topologically Sorted
+        unsigned int node = unsigned(mParents.size());
+        if (parent >= int(node)) { fprintf(stderr, "Invalid Parent Node %d\n", parent); parent = -1; }
+        unsigned int depth = parent < 0 ? 0 : mDepths[parent] + 1;
+        if (depth >= mLevels.size()) mLevels.resize(depth + 1);
+        mLevels[depth].push_back(node);
+
+        mParents.push_back(parent);
+        mDepths.push_back(depth);
+        mTranslations.push_back(translation);
+        mRotations.push_back(rotation);
+        mScales.push_back(scale);
+        mWorlds.push_back(glm::mat4(1.0f));
+        mDirty.push_back(0);
+        mChanged.push_back(0);
+        dirty(node);
+        return node;
+    }
+
+    void Transforms::set(unsigned int node, glm::vec3 const & translation,
+                         glm::vec4 const & rotation, glm::vec3 const & scale)
+    {
+        mTranslations[node] = translation;
+        mRotations[node] = rotation;
+        mScales[node] = scale;
+        dirty(node);
+    }
+
+    void Transforms::translate(unsigned int node, glm::vec3 const & translation)
+    {
+        mTranslations[node] = translation;
+        dirty(node);
+    }
+
+    void Transforms::rotate(unsigned int node, glm::vec4 const & rotation)
+    {
+        mRotations[node] = rotation;
+        dirty(node);
+    }
+
+    void Transforms::update(Scheduler * scheduler)
+    {
+        if (mDirtyLevel == ~0u && mChangedLevel == ~0u) return;
+
+        // Levels Above Anything Dirty Keep their Worlds; Just Forget Last Update's Changes
+        std::size_t first = std::min<std::size_t>(mDirtyLevel, mLevels.size());
+        for (std::size_t depth = mChangedLevel; depth < first; depth++)
+            for (auto i : mLevels[depth]) mChanged[i] = 0;
+
+        // Every Level Only Reads its Parents' Worlds, Which the Previous Level Finished
+        for (std::size_t depth = first; depth < mLevels.size(); depth++)
+        {
+            auto const & level = mLevels[depth];
+            if (scheduler && level.size() > kGrain)
+                scheduler->parallel_for(level.size(), kGrain, [this, & level](std::size_t begin, std::size_t end) {
+                    update(level, begin, end);
+                });
+            else update(level, 0, level.size());
+        }
+
+        mChangedLevel = mDirtyLevel;
+        mDirtyLevel = ~0u;
+    }
+
+    void Transforms::dirty(unsigned int node)
+    {
+        mDirty[node] = 1;
+        mDirtyLevel = std::min(mDirtyLevel, mDepths[node]);
+    }
+
+    void Transforms::update(std::vector<unsigned int> const & level, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t k = begin; k < end; k++)
+        {
+            // Recompute Only Where the Node or One of its Ancestors Moved
+            unsigned int i = level[k];
+            int parent = mParents[i];
+            bool changed = mDirty[i] || (parent >= 0 && mChanged[parent]);
+            mDirty[i] = 0;
+            mChanged[i] = changed;
+            if (changed == false) continue;
+
+            glm::mat4 local = compose(mTranslations[i], mRotations[i], mScales[i]);
+            if (parent < 0) mWorlds[i] = local;
+            else multiply(mWorlds[parent], local, mWorlds[i]);
+        }
+    }
+
+    void Transforms::decompose(glm::mat4 const & m, glm::vec3 & translation,
+                               glm::vec4 & rotation, glm::vec3 & scale)
+    {
+        glm::vec3 axes[3];
+        for (int i = 0; i < 3; i++)
+        {
+            axes[i] = glm::vec3(m[i]);
+            scale[i] = glm::length(axes[i]);
+            axes[i] = axes[i] / (scale[i] > 0.0f ? scale[i] : 1.0f);
+        }
+
+        // Mirrored Bases Aren't Rotations; Flip One Axis into the Scale
+        if (glm::dot(glm::cross(axes[0], axes[1]), axes[2]) < 0.0f)
+        {
+            scale.x = -scale.x;
+            axes[0] = -axes[0];
+        }
+
+        // Rotation Matrix to Quaternion, Branching on the Largest Diagonal Term
+        float x, y, z, w, trace = axes[0].x + axes[1].y + axes[2].z;
+        if (trace > 0.0f)
+        {
+            float s = std::sqrt(trace + 1.0f) * 2.0f;
+            w = 0.25f * s; x = (axes[1].z - axes[2].y) / s; y = (axes[2].x - axes[0].z) / s; z = (axes[0].y - axes[1].x) / s;
+        }
+        else if (axes[0].x > axes[1].y && axes[0].x > axes[2].z)
+        {
+            float s = std::sqrt(1.0f + axes[0].x - axes[1].y - axes[2].z) * 2.0f;
+            w = (axes[1].z - axes[2].y) / s; x = 0.25f * s; y = (axes[1].x + axes[0].y) / s; z = (axes[2].x + axes[0].z) / s;
+        }
+        else if (axes[1].y > axes[2].z)
+        {
+            float s = std::sqrt(1.0f + axes[1].y - axes[0].x - axes[2].z) * 2.0f;
+            w = (axes[2].x - axes[0].z) / s; x = (axes[1].x + axes[0].y) / s; y = 0.25f * s; z = (axes[2].y + axes[1].z) / s;
+        }
+        else
+        {
+            float s = std::sqrt(1.0f + axes[2].z - axes[0].x - axes[1].y) * 2.0f;
+            w = (axes[0].y - axes[1].x) / s; x = (axes[2].x + axes[0].z) / s; y = (axes[2].y + axes[1].z) / s; z = 0.25f * s;
+        }
+
+        translation = glm::vec3(m[3]);
+        rotation = glm::vec4(x, y, z, w);
+    }
+
+    glm::mat4 Transforms::compose(glm::vec3 const & translation,
+                                  glm::vec4 const & rotation, glm::vec3 const & scale)
+    {
+        // Normalize so Blended or Accumulated Rotations Don't Skew the Basis
+        float length = glm::length(rotation);
+        float x = rotation.x / length, y = rotation.y / length, z = rotation.z / length, w = rotation.w / length;
+        return glm::mat4(
+            glm::vec4(1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + w * z), 2.0f * (x * z - w * y), 0.0f) * scale.x,
+            glm::vec4(2.0f * (x * y - w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + w * x), 0.0f) * scale.y,
+            glm::vec4(2.0f * (x * z + w * y), 2.0f * (y * z - w * x), 1.0f - 2.0f * (x * x + y * y), 0.0f) * scale.z,
+            glm::vec4(translation, 1.0f));
+    }
+};
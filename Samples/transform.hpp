@@ -0,0 +1,78 @@
+#pragma once
+
+// Local Headers
+#include "jobs.hpp"
+
+// System Headers
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <cstddef>
+#include <vector>
+
+// Define Namespace
+namespace Mirage
+{
+    // Flattened Scene Hierarchy. Nodes are Stored SoA (Parent, Local TRS,
+    // World Matrix) with Parents Always Preceding their Children, and Grouped
+    // by Depth so update() Can Finish One Level in Parallel Before the Next.
+    // Only Nodes Whose Local Transform or Ancestors Changed are Recomputed.
+    class Transforms
+    {
+    public:
+
+        // Implement Default Constructor
+        Transforms() = default;
+
+        // Rotations are Quaternions Stored as (x, y, z, w)
+        unsigned int add(int parent, glm::mat4 const & local);
+        unsigned int add(int parent, glm::vec3 const & translation,
+                         glm::vec4 const & rotation, glm::vec3 const & scale);
+
+        // Public Member Functions
+        void set(unsigned int node, glm::vec3 const & translation,
+                 glm::vec4 const & rotation, glm::vec3 const & scale);
+        void translate(unsigned int node, glm::vec3 const & translation);
+        void rotate(unsigned int node, glm::vec4 const & rotation);
+        void update(Scheduler * scheduler = nullptr);
+        glm::mat4 const & world(unsigned int node) const { return mWorlds[node]; }
+        bool changed(unsigned int node) const { return mChanged[node] != 0; }
+        int  parent(unsigned int node)  const { return mParents[node]; }
+        std::size_t size() const { return mParents.size(); }
+
+        // Conversions Between Affine Matrices and TRS Components
+        static void decompose(glm::mat4 const & m, glm::vec3 & translation,
+                              glm::vec4 & rotation, glm::vec3 & scale);
+        static glm::mat4 compose(glm::vec3 const & translation,
+                                 glm::vec4 const & rotation, glm::vec3 const & scale);
+
+    private:
+
+        // Disable Copying and Assignment
+        Transforms(Transforms const &) = delete;
+        Transforms & operator=(Transforms const &) = delete;
+
+        // Levels Smaller than This are Updated Serially
+        static const std::size_t kGrain = 256;
+
+        // Private Member Functions
+        void dirty(unsigned int node);
+        void update(std::vector<unsigned int> const & level, std::size_t begin, std::size_t end);
+
+        // Private Member Containers
+        std::vector<int>         mParents;
+        std::vector<unsigned int> mDepths;
+        std::vector<glm::vec3>   mTranslations;
+        std::vector<glm::vec4>   mRotations;
+        std::vector<glm::vec3>   mScales;
+        std::vector<glm::mat4>   mWorlds;
+        std::vector<unsigned char> mDirty;
+        std::vector<unsigned char> mChanged;
+        std::vector<std::vector<unsigned int>> mLevels;
+
+        // Private Member Variables; Shallowest Levels Holding Dirty or Changed Nodes
+        unsigned int mDirtyLevel   = ~0u;
+        unsigned int mChangedLevel = ~0u;
+
+    };
+};
@@ -0,0 +1,103 @@
+// Local Headers
+#include "uniforms.hpp"
+
+// Standard Headers
+#include <cstdio>
+#include <cstring>
+
+// Define Namespace
+namespace Mirage
+{
+    UniformBuffer::UniformBuffer(std::size_t size, void const * data, GLenum usage)
+        : mSize(size), mUsage(usage)
+    {
+        glGenBuffers(1, & mBuffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, size, data, usage);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    void UniformBuffer::update(void const * data)
+    {
+        // Orphan the Old Storage so the Driver Needn't Wait on Pending Draws
+        glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, mSize, nullptr, mUsage);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, mSize, data);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    UniformRing::UniformRing(std::size_t capacity)
+    {
+        // Ranges Bound to a Uniform Block Must Start on this Alignment
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, & mAlignment);
+        mCapacity = (capacity + mAlignment - 1) / mAlignment * mAlignment;
+        for (auto &i : mFences) i = nullptr;
+
+        glGenBuffers(1, & mBuffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, mCapacity * kSegments, nullptr, GL_STREAM_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    UniformRing::~UniformRing()
+    {
+        for (auto &i : mFences) if (i) glDeleteSync(i);
+        glDeleteBuffers(1, & mBuffer);
+    }
+
+    void UniformRing::begin()
+    {
+        // Last Frame Ran Out of Room; the Cursor Kept Counting, so Grow Past
+        // its Demand. Respecifying Orphans the Old Store Along with its Fences
+        if (mCursor > mCapacity)
+        {
+            GLintptr demand = mCursor + mCursor / 4;
+            mCapacity = (demand + mAlignment - 1) / mAlignment * mAlignment;
+            for (auto &i : mFences) if (i) { glDeleteSync(i); i = nullptr; }
+            glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+            glBufferData(GL_UNIFORM_BUFFER, mCapacity * kSegments, nullptr, GL_STREAM_DRAW);
+            fprintf(stderr, "Uniform Ring Grew to %ld Bytes per Segment\n", long(mCapacity));
+        }
+
+        // Wait Until the GPU Has Finished with the Segment We're About to Reuse
+        mSegment = (mSegment + 1) % kSegments;
+        if (mFences[mSegment])
+        {
+            glClientWaitSync(mFences[mSegment], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(mFences[mSegment]);
+            mFences[mSegment] = nullptr;
+        }
+
+        mCursor = 0;
+        glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+        mMapped = static_cast<unsigned char *>(glMapBufferRange(GL_UNIFORM_BUFFER,
+            mSegment * mCapacity, mCapacity,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+        if (mMapped == nullptr) fprintf(stderr, "Failed to Map Uniform Ring\n");
+    }
+
+    GLintptr UniformRing::push(void const * data, std::size_t size)
+    {
+        // Keep Counting Past the End so begin() Knows How Much to Grow
+        GLintptr cursor = mCursor;
+        mCursor += (size + mAlignment - 1) / mAlignment * mAlignment;
+        if (mMapped == nullptr || cursor + GLintptr(size) > mCapacity) return -1;
+
+        // Return the Offset Within the Whole Buffer, Ready for bind()
+        std::memcpy(mMapped + cursor, data, size);
+        return mSegment * mCapacity + cursor;
+    }
+
+    void UniformRing::end()
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+        glUnmapBuffer(GL_UNIFORM_BUFFER);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        mMapped = nullptr;
+    }
+
+    void UniformRing::fence()
+    {
+        mFences[mSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+// System Headers
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Standard Headers
+#include <cstddef>
+
+// Define Namespace
+namespace Mirage
+{
+    // Binding Points Shared by Every Program; Declare Matching Blocks in GLSL:
+    //
+    //     layout (std140) uniform Frame    { mat4 view; mat4 projection;
+    //                                        mat4 view_projection; vec4 eye_time; };
+    //     layout (std140) uniform Material { vec4 color; vec4 specular_shininess;
+    //                                        ivec4 layers; };
+    //     layout (std140) uniform Object   { mat4 model; mat4 transform; };
+    //
+    // and Call Shader::block() for Each so the Program Uses these Bindings.
+    enum UniformBinding : GLuint {
+        FrameBinding    = 0,
+        MaterialBinding = 1,
+        ObjectBinding   = 2,
+    };
+
+    // Blocks Only Use vec4, ivec4 (GLint[4]) and mat4 Members, Each a Multiple
+    // of 16 Bytes with No Padding Between, so std140 Matches C++ Layout
+    struct FrameBlock {
+        glm::mat4 view;
+        glm::mat4 projection;
+        glm::mat4 view_projection;
+        glm::vec4 eye_time;
+    };
+
+    // Uploaded Once per Submesh by Mesh; Layers Index the Packed Diffuse,
+    // Specular, Diffuse2 and Specular2 Arrays, or are -1
+    struct MaterialBlock {
+        glm::vec4 color;
+        glm::vec4 specular_shininess;
+        GLint     layers[4];
+    };
+
+    struct ObjectBlock {
+        glm::mat4 model;
+        glm::mat4 transform;
+    };
+
+    // Uniform Buffer Written Whole, Such as Per-Frame or Per-Material Data
+    class UniformBuffer
+    {
+    public:
+
+        // Implement Custom Constructor and Destructor
+         UniformBuffer(std::size_t size, void const * data = nullptr, GLenum usage = GL_DYNAMIC_DRAW);
+        ~UniformBuffer() { glDeleteBuffers(1, & mBuffer); }
+
+        // Public Member Functions
+        void update(void const * data);
+        void bind(GLuint binding) const { glBindBufferBase(GL_UNIFORM_BUFFER, binding, mBuffer); }
+
+    private:
+
+        // Disable Copying and Assignment
+        UniformBuffer(UniformBuffer const &) = delete;
+        UniformBuffer & operator=(UniformBuffer const &) = delete;
+
+        // Private Member Variables
+        GLuint mBuffer;
+        std::size_t mSize;
+        GLenum mUsage;
+
+    };
+
+    // Ring of Per-Frame Segments for Per-Object Blocks. Each Frame Maps the
+    // Next Segment Unsynchronized (a Fence Guards Against the GPU Still
+    // Reading It), Copies Every Object's Block in, and Draws Then Select
+    // Their Block with glBindBufferRange Instead of Setting Uniforms. Once a
+    // Segment is Full push() Returns -1 (Skip that Draw), and the Next begin()
+    // Grows the Ring Past the Demand it Saw.
+    class UniformRing
+    {
+    public:
+
+        // Segments Should Match the Number of Frames in Flight
+        static const unsigned int kSegments = 3;
+
+        // Implement Custom Constructor and Destructor
+         UniformRing(std::size_t capacity);
+        ~UniformRing();
+
+        // Call begin(), push() Each Block, end(), Draw, then fence()
+        void     begin();
+        GLintptr push(void const * data, std::size_t size);
+        void     end();
+        void     fence();
+        void     bind(GLuint binding, GLintptr offset, std::size_t size) const
+        { glBindBufferRange(GL_UNIFORM_BUFFER, binding, mBuffer, offset, size); }
+
+    private:
+
+        // Disable Copying and Assignment
+        UniformRing(UniformRing const &) = delete;
+        UniformRing & operator=(UniformRing const &) = delete;
+
+        // Private Member Variables
+        GLuint   mBuffer;
+        GLsync   mFences[kSegments];
+        GLint    mAlignment;
+        GLintptr mCapacity;
+        GLintptr mCursor = 0;
+        unsigned int mSegment = 0;
+        unsigned char * mMapped = nullptr;
+
+    };
+};